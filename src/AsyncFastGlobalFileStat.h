@@ -6,6 +6,8 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Global properties are found through the mount
+ *                     point index.
  *        Jun 21 2011 DHA: File created
  *
  */
@@ -97,6 +99,12 @@ namespace FastGlobalFileStatus {
 
     private:
 
+        /**
+         *   Returns the classified GlobalProperties of the mount
+         *   point serving this path or NULL if it wasn't classified
+         */
+        const GlobalProperties * findGlobalProperties() const;
+
         static MountPointsClassifier mMpClassifier;
     };
 
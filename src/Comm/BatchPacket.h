@@ -0,0 +1,110 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef BATCH_PACKET_H
+#define BATCH_PACKET_H 1
+
+extern "C" {
+#include <stdint.h>
+#include <stddef.h>
+}
+
+#include <vector>
+#include "CommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   FGFS_BATCH_PACKET_VERSION
+     *   Version of the packed batch
+     */
+    const uint32_t FGFS_BATCH_PACKET_VERSION = 1;
+
+
+    /**
+     *   Carries the global reductions and broadcasts of a batch (see
+     *   CommFabric::beginBatch) in one message. Reducing two packets
+     *   reduces each entry with its own type and operator; a
+     *   broadcast entry keeps the root's bytes.
+     *
+     *   Packed layout, native byte order:
+     *
+     *     uint32_t version, entries, failed, reserved
+     *     per entry:
+     *       uint32_t ReduceDataType, ReduceOperator, bytes, reserved
+     *       payload, padded to 8 bytes
+     *
+     *   A broadcast entry has REDUCE_UNKNOWN_OP. failed is set once
+     *   a reduction along the way fails, so that the packet is
+     *   rejected wherever it ends up.
+     */
+    class FgfsBatchPacket {
+    public:
+
+        /**
+         *   Packs the send buffers of ops
+         *
+         *   @param[in] ops operations splitBatch found coalescable
+         *   @param[out] len size of the packet
+         *
+         *   @return malloc'd packet the caller frees; NULL on error
+         */
+        static char * pack(const std::vector<CommBatchOp> &ops,
+                           size_t *len);
+
+        /**
+         *   Reduces packet in into packet acc, entry by entry
+         *
+         *   @param[in,out] acc packet, 8-byte aligned
+         *   @param[in] in packet of the same operations
+         *   @param[in] len size of both
+         *   @param[in] inIsRoot true if in, not acc, comes from the
+         *                       side of the broadcast root
+         *
+         *   @return false if the packets don't match, are malformed
+         *           or either has failed
+         */
+        static bool reduce(char *acc,
+                           const char *in,
+                           size_t len,
+                           bool inIsRoot);
+
+        /**
+         *   Marks a packet as failed, e.g., when reduce returned false
+         *
+         *   @param[in,out] buf packet
+         *   @param[in] len size of buf
+         */
+        static void setFailed(char *buf, size_t len);
+
+        /**
+         *   Copies the results in a reduced packet to the receive
+         *   buffers of ops
+         *
+         *   @return false if the packet doesn't match ops or has failed
+         */
+        static bool unpack(const char *buf,
+                           size_t len,
+                           const std::vector<CommBatchOp> &ops);
+
+        /**
+         *   Returns the payload size of an operation
+         */
+        static size_t byteLength(const CommBatchOp &o);
+    };
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // BATCH_PACKET_H
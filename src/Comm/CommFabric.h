@@ -5,6 +5,15 @@
  * All rights reserved.
  *
  * Update Log:
+ *        Oct 17 2026: Added allocNodeShared and NodeSharedSegment.
+ *        Oct 17 2026: Added beginBatch and flush.
+ *        Oct 17 2026: Added REDUCE_UINT64 and REDUCE_DOUBLE.
+ *        Oct 17 2026: Added GroupingMode.
+ *        Oct 17 2026: Added the nonblocking iallReduce and ibroadcast
+ *                     interfaces and CommRequest.
+ *        Oct 17 2026: Added REDUCE_SPARSE_BITSET.
+ *        Oct 17 2026: Added the splitNodeLocal and reduceMap interfaces
+ *                     to support hierarchical algorithms.
  *        Jul 05 2011 DHA: Added the reduceMap interface
  *        Jun 27 2011 DHA: Changed the interface to support "stateless"
  *                         communication fabric. The most state is hold
@@ -31,10 +40,19 @@ namespace FastGlobalFileStatus {
   namespace CommLayer {
 
 
+    /**
+     *   REDUCE_SPARSE_BITSET is a SparseBitSet whose length is given
+     *   in uint32_t words; it is only defined for REDUCE_BOR.
+     *   REDUCE_DOUBLE isn't defined for REDUCE_BOR. Other types
+     *   reduce element-wise over an array of any length.
+     */
     enum ReduceDataType {
         REDUCE_INT = 0,
         REDUCE_LONG_LONG_INT,
         REDUCE_CHAR_ARRAY,
+        REDUCE_SPARSE_BITSET,
+        REDUCE_UINT64,
+        REDUCE_DOUBLE,
         REDUCE_UNKNOWN_TYPE
     };
 
@@ -48,6 +66,137 @@ namespace FastGlobalFileStatus {
     };
 
 
+    /**
+     *   Enumerates what grouping delivers to each process. With
+     *   gm_scatter, the grouping map of pd ends up partial (see
+     *   FgfsParDesc::setPartialMap) and holds only the caller's item.
+     */
+    enum GroupingMode {
+        gm_fullMap,             // the whole grouping map
+        gm_scatter              // only the caller's own group info
+    };
+
+
+    /**
+     *   An allReduce or broadcast recorded between beginBatch and
+     *   flush. For a broadcast, r is s and t and op are
+     *   REDUCE_CHAR_ARRAY and REDUCE_UNKNOWN_OP.
+     */
+    struct CommBatchOp {
+        bool isBroadcast;
+        bool global;
+        FgfsParDesc *pd;
+        void *s;
+        void *r;
+        FgfsCount_t len;
+        ReduceDataType t;
+        ReduceOperator op;
+    };
+
+
+    /**
+     *   Handle of a nonblocking collective started by iallReduce or
+     *   ibroadcast. The buffers passed to the operation must not be
+     *   touched until the request has completed. The caller owns the
+     *   handle; deleting a request that is still in flight waits for
+     *   it first since collectives can't be cancelled.
+     */
+    class CommRequest {
+    public:
+
+        CommRequest();
+
+        virtual ~CommRequest();
+
+        /**
+         *   Checks for completion without blocking
+         *
+         *   @return true once the operation has completed
+         */
+        virtual bool test() = 0;
+
+        /**
+         *   Blocks until the operation has completed
+         *
+         *   @return false if the operation failed
+         */
+        virtual bool wait() = 0;
+
+    private:
+
+        CommRequest(const CommRequest &r);
+    };
+
+
+    /**
+     *   A request that is complete at creation. Fabrics without
+     *   nonblocking collectives return it from the default iallReduce
+     *   and ibroadcast after running the blocking operation.
+     */
+    class CompletedCommRequest : public CommRequest {
+    public:
+
+        CompletedCommRequest(bool rc);
+
+        virtual ~CompletedCommRequest();
+
+        virtual bool test();
+
+        virtual bool wait();
+
+    private:
+
+        bool mRc;
+    };
+
+
+    /**
+     *   Memory that the processes of a node share, allocated by
+     *   CommFabric::allocNodeShared. The node leader (the lowest
+     *   rank of the node) owns it: it writes the segment and then
+     *   calls publish; the others call publish and then read it.
+     *   publish and the Dtor are node-local collectives.
+     */
+    class NodeSharedSegment {
+    public:
+
+        /**
+         *   NodeSharedSegment Ctor
+         *
+         *   @param[in] base the caller's mapping of the segment
+         *   @param[in] size the size of the segment
+         *   @param[in] owner true on the node leader
+         */
+        NodeSharedSegment(void *base, size_t size, bool owner);
+
+        virtual ~NodeSharedSegment();
+
+        void *getBase() const;
+
+        size_t getSize() const;
+
+        bool isOwner() const;
+
+        /**
+         *   Makes the owner's writes visible to the node. Every
+         *   process of the node must call it.
+         *
+         *   @return a bool value
+         */
+        virtual bool publish() = 0;
+
+    protected:
+
+        void *mBase;
+        size_t mSize;
+        bool mOwner;
+
+    private:
+
+        NodeSharedSegment(const NodeSharedSegment &s);
+    };
+
+
     /**
      * Defines the base communication fabric class. This class must be
      * dervided with the target communication fabric. The derived class
@@ -115,6 +264,48 @@ namespace FastGlobalFileStatus {
                                unsigned char *s,
                                FgfsCount_t len) const = 0;
 
+        /**
+         *   Virtual Interface: iallReduce
+         *   Nonblocking allReduce. The default implementation performs
+         *   the blocking allReduce and returns a completed request.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[out] r receiver buffer
+         *   @param[in] len length of the buffer
+         *   @param[in] t ReduceDataType
+         *   @param[in] op ReduceOperator
+         *
+         *   @return a CommRequest object owned by the caller;
+         *           NULL if the operation couldn't be started
+         */
+        virtual CommRequest *iallReduce(bool global,
+                                        FgfsParDesc &pd,
+                                        void *s,
+                                        void *r,
+                                        FgfsCount_t len,
+                                        ReduceDataType t,
+                                        ReduceOperator op) const;
+
+        /**
+         *   Virtual Interface: ibroadcast
+         *   Nonblocking broadcast. The default implementation performs
+         *   the blocking broadcast and returns a completed request.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[in] len length of the buffer
+         *
+         *   @return a CommRequest object owned by the caller;
+         *           NULL if the operation couldn't be started
+         */
+        virtual CommRequest *ibroadcast(bool global,
+                                        FgfsParDesc &pd,
+                                        unsigned char *s,
+                                        FgfsCount_t len) const;
+
         /**
          *   Virtual Interface: grouping
          *
@@ -158,6 +349,58 @@ namespace FastGlobalFileStatus {
          */
         virtual bool getRankSize(int *rank, int *size, bool *glMaster) const = 0;
 
+        /**
+         *   Virtual Interface: splitNodeLocal
+         *   Splits this fabric into a node-local fabric that contains
+         *   all of the processes sharing the caller's node and a leader
+         *   fabric that contains one process (the lowest rank) per node.
+         *   This is a global collective. The caller owns the returned
+         *   fabric objects. The default implementation doesn't support
+         *   splitting and returns false.
+         *
+         *   @param[out] nodeFab node-local fabric
+         *   @param[out] leaderFab leader fabric; NULL if the caller
+         *                          isn't a node leader
+         *
+         *   @return a bool value
+         */
+        virtual bool splitNodeLocal(CommFabric **nodeFab,
+                                    CommFabric **leaderFab) const;
+
+        /**
+         *   Virtual Interface: allocNodeShared
+         *   Allocates a segment of len bytes that all of the processes
+         *   sharing the caller's node map, so that one of them can do
+         *   node-local work for the rest. This is a global collective.
+         *   The caller owns the returned segment. The default
+         *   implementation doesn't support sharing and returns NULL.
+         *
+         *   @param[in] len size of the segment; only the node
+         *                  leader's counts, so the others may pass 0
+         *                  and learn it from getSize
+         *
+         *   @return a NodeSharedSegment object or NULL
+         */
+        virtual NodeSharedSegment *allocNodeShared(FgfsCount_t len) const;
+
+        /**
+         *   Virtual Interface: reduceMap
+         *   Reduces the grouping map that the caller has already filled
+         *   into pd and distributes the result to all processes. Unlike
+         *   mapReduce, the ReduceDesc entries (first rank and count) are
+         *   taken as is, which allows a process to speak for others. The
+         *   default implementation returns false.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in,out] pd an FgfsStatDesc object
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceMap(bool global,
+                               FgfsParDesc &pd,
+                               bool elimAlias) const;
+
         /**
          *   Virtual Interface: return the net object
          *
@@ -172,11 +415,90 @@ namespace FastGlobalFileStatus {
          */
         virtual void *getChannel();
 
+        /**
+         *   Selects what grouping delivers; gm_fullMap by default.
+         *   All processes must select the same mode.
+         *
+         *   @param[in] mode a GroupingMode value
+         */
+        void setGroupingMode(GroupingMode mode);
+        GroupingMode getGroupingMode() const;
+
+        /**
+         *   Starts recording: allReduce and broadcast calls until
+         *   flush only queue the operation and return true. Their
+         *   buffers must stay valid, and their results are valid,
+         *   only after flush. The queued operations must not depend
+         *   on each other. All processes must batch the same calls.
+         *
+         *   @return false if a batch is already open
+         */
+        bool beginBatch() const;
+
+        /**
+         *   Runs the queued operations, coalesced as the fabric
+         *   can (see flushBatch), and closes the batch
+         *
+         *   @return false if any of them failed or no batch is open
+         */
+        bool flush() const;
+
+        bool isBatching() const;
+
+
+    protected:
+
+        /**
+         *   Queue an operation if a batch is open; the fabrics call
+         *   these first thing in allReduce and broadcast
+         *
+         *   @return true if the operation was queued
+         */
+        bool recordAllReduce(bool global,
+                             FgfsParDesc &pd,
+                             void *s,
+                             void *r,
+                             FgfsCount_t len,
+                             ReduceDataType t,
+                             ReduceOperator op) const;
+
+        bool recordBroadcast(bool global,
+                             FgfsParDesc &pd,
+                             unsigned char *s,
+                             FgfsCount_t len) const;
+
+        /**
+         *   Virtual Interface: flushBatch
+         *   Runs the operations of a batch, in order. The default
+         *   implementation runs them one at a time; fabrics coalesce
+         *   what splitBatch finds coalescable and pass the rest here.
+         *
+         *   @param[in] ops the queued operations
+         *
+         *   @return false if any of them failed
+         */
+        virtual bool flushBatch(std::vector<CommBatchOp> &ops) const;
+
+        /**
+         *   Splits ops into the global element-wise reductions and
+         *   broadcasts, which FgfsBatchPacket can carry in one
+         *   message, and the rest
+         */
+        static void splitBatch(std::vector<CommBatchOp> &ops,
+                               std::vector<CommBatchOp> &coalesced,
+                               std::vector<CommBatchOp> &rest);
+
 
     private:
 
         CommFabric(const CommFabric &c);
 
+        GroupingMode mGroupingMode;
+
+        mutable bool mBatching;
+
+        mutable std::vector<CommBatchOp> mBatch;
+
     };
 
   } // CommLayer namespace
@@ -6,6 +6,13 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Versioned, front-coded packed map format with
+ *                     optional LZ compression.
+ *        Oct 17 2026: Conversions from and to FgfsGroupTable replace
+ *                     the group table serializers.
+ *        Oct 17 2026: Added the group table.
+ *        Oct 17 2026: Added partial grouping maps.
+ *        Oct 17 2026: Added the grouping hash to FgfsParDesc.
  *        Jun 24 2011 DHA: File created (Copied from old CommFabric.h)
  *
  */
@@ -25,6 +32,9 @@ namespace FastGlobalFileStatus {
 
   namespace CommLayer {
 
+    class FgfsGroupTable;
+    class FgfsGroupTableView;
+
     /**
      *   FGFS_NOT_FILLED
      *   Defines a value to indicate uninitialized integer
@@ -45,9 +55,24 @@ namespace FastGlobalFileStatus {
 
 
     /**
-     *   typedef for BloomFilterAlign_t
+     *   FGFS_PACKED_MAP_VERSION
+     *   Version of the packed grouping map
+     */
+    const unsigned char FGFS_PACKED_MAP_VERSION = 1;
+
+
+    /**
+     *   FGFS_PACKED_MAP_LZ_THRESHOLD
+     *   Default size from which a packed grouping map is compressed
      */
-    typedef uint32_t BloomFilterAlign_t;
+    const size_t FGFS_PACKED_MAP_LZ_THRESHOLD = 4096;
+
+
+    /**
+     *   typedef for BloomFilterAlign_t: bloom filters and other
+     *   bit sets are sized in multiples of this word
+     */
+    typedef uint64_t BloomFilterAlign_t;
 
 
     /**
@@ -196,15 +221,50 @@ namespace FastGlobalFileStatus {
 
 
         /**
-         *   (de)serialers for the reducer map
+         *   (de)serialers for the reducer map. The packed map is
+         *
+         *     version byte, flags byte, varint number of entries,
+         *     varint body size, [varint compressed size,] body
+         *
+         *   The body lists the entries in item order, each as varint
+         *   length of the prefix shared with the previous item,
+         *   varint suffix length, the suffix, and varint first rank
+         *   and count. A body of at least the LZ threshold is
+         *   compressed with PackCodec if that makes it smaller.
+         *
+         *   packedSize is an upper bound; pack returns the actual
+         *   size, 0 if s is too small. unpack merges the entries into
+         *   the map and returns the size it consumed, 0 if malformed.
          */
         size_t pack(char *buf, size_t s) const;
         size_t unpack(char *buf, size_t s);
         size_t packedSize() const;
 
+        /**
+         *   Sets the body size from which pack compresses; (size_t)-1
+         *   turns compression off
+         */
+        static void setPackLzThreshold(size_t bytes);
+        static size_t getPackLzThreshold();
+
+
+        /**
+         *   Conversions between the grouping map and an FgfsGroupTable.
+         *   fillGroupTable adds the map to t, with or without item
+         *   strings, and sorts it. setFromGroupTable replaces the map:
+         *   with the whole table if it carries all item strings, else
+         *   with the entry of this process's uri string only, making
+         *   the map partial; then it fails if that entry isn't there.
+         */
+        void fillGroupTable(FgfsGroupTable &t, bool keepStrings) const;
+        bool setFromGroupTable(const FgfsGroupTableView &v);
+
 
         /**
-         *   operators on the reducer map
+         *   operators on the reducer map. After a hash-partitioned
+         *   grouping the map is partial (see setPartialMap): it holds
+         *   only the items this process contributed, each with its
+         *   global first rank and count.
          */
         FGFSInfoAnswer insert(std::string &item, ReduceDesc &robj);
         FGFSInfoAnswer mapEmpty();
@@ -228,6 +288,39 @@ namespace FastGlobalFileStatus {
         FGFSInfoAnswer setGroupInfo();
 
 
+        /**
+         *   Returns a hash of the grouping map taken by setGroupInfo.
+         *   The map is the same on all processes after a grouping, so
+         *   this identifies the grouping globally; 0 if not grouped.
+         */
+        uint64_t getGroupingHash() const;
+
+
+        /**
+         *   Marks the grouping map as partial. numGroups and
+         *   entryHashSum, the sum of hashGroupEntry over the whole
+         *   map, stand in for the whole map in setGroupInfo.
+         *   clearMap resets it.
+         *
+         *   @param[in] numGroups global number of distinct items
+         *   @param[in] entryHashSum sum of the global entry hashes
+         */
+        void setPartialMap(FgfsCount_t numGroups, uint64_t entryHashSum);
+        FGFSInfoAnswer isPartialMap() const;
+
+
+        /**
+         *   Hashes of a grouping item and of a grouping map entry.
+         *   They are the same on every process.
+         */
+        static uint64_t hashItem(const std::string &item);
+        static uint64_t hashGroupEntry(const std::string &item,
+                                       const ReduceDesc &r);
+        static uint64_t hashGroupEntry(uint64_t itemHash,
+                                       FgfsId_t firstRank,
+                                       FgfsCount_t count);
+
+
     private:
 
         /**
@@ -252,6 +345,13 @@ namespace FastGlobalFileStatus {
          */
         std::string mUriString;
         std::map<std::string, ReduceDesc> groupingMap;
+        uint64_t mGroupingHash;
+        bool mPartialMap;
+        uint64_t mEntryHashSum;
+
+        size_t packedBodySize() const;
+
+        static size_t mPackLzThreshold;
     };
 
   } // CommLayer namespace
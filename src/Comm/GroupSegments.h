@@ -0,0 +1,116 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef GROUP_SEGMENTS_H
+#define GROUP_SEGMENTS_H 1
+
+extern "C" {
+#include <stdint.h>
+#include <stddef.h>
+}
+
+#include "CommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   FGFS_GROUP_SEGMENTS_VERSION
+     *   Version of the packed group segments
+     */
+    const uint32_t FGFS_GROUP_SEGMENTS_VERSION = 1;
+
+
+    /**
+     *   Group segments let a fabric whose only collectives span all
+     *   processes, like MRNet's tree, run group-wise reductions and
+     *   broadcasts: every process sends the segment of its group,
+     *   tagged with the group id, and merging combines the segments
+     *   of the same group with the reduction operator. Each process
+     *   then finds its group's segment in the merged result.
+     *
+     *   REDUCE_UNKNOWN_OP merges by keeping the first segment of a
+     *   group, which is how a group broadcast is done: only the
+     *   group's representative sends a segment.
+     *
+     *   Packed layout, native byte order:
+     *
+     *     uint32_t version, ReduceDataType, ReduceOperator, segments
+     *     per segment, sorted by group id:
+     *       uint32_t group id, payload bytes
+     *       payload, padded to 8 bytes
+     *
+     *   REDUCE_SPARSE_BITSET isn't supported.
+     */
+    class FgfsGroupSegments {
+    public:
+
+        /**
+         *   Packs the segment of one group, or none if data is NULL
+         *
+         *   @param[in] gid group id
+         *   @param[in] t ReduceDataType
+         *   @param[in] op ReduceOperator
+         *   @param[in] data payload
+         *   @param[in] len payload bytes
+         *   @param[out] outLen size of the packed segments
+         *
+         *   @return malloc'd buffer the caller frees; NULL on error
+         */
+        static char * single(uint32_t gid,
+                             ReduceDataType t,
+                             ReduceOperator op,
+                             const void *data,
+                             size_t len,
+                             size_t *outLen);
+
+        /**
+         *   Merges k packed segment buffers of the same type and op
+         *
+         *   @param[in] bufs packed segments, 8-byte aligned
+         *   @param[in] lens their sizes
+         *   @param[in] k number of buffers
+         *   @param[out] outLen size of the merged segments
+         *
+         *   @return malloc'd buffer the caller frees; NULL if a
+         *           buffer is malformed, the buffers don't agree on
+         *           type and op, or segments of a group differ in size
+         */
+        static char * merge(const char * const *bufs,
+                            const size_t *lens,
+                            size_t k,
+                            size_t *outLen);
+
+        /**
+         *   Finds the payload of group gid
+         *
+         *   @return a pointer into buf; NULL if not found or malformed
+         */
+        static const char * find(const char *buf,
+                                 size_t len,
+                                 uint32_t gid,
+                                 size_t *segLen);
+
+    private:
+
+        static bool combine(ReduceDataType t,
+                            ReduceOperator op,
+                            char *acc,
+                            const char *in,
+                            size_t len);
+    };
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // GROUP_SEGMENTS_H
@@ -0,0 +1,202 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: Added the k-way merge of packed runs.
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef GROUP_TABLE_H
+#define GROUP_TABLE_H 1
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include <string>
+#include <vector>
+#include "DistDesc.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   FGFS_GROUP_TABLE_NO_STRING
+     *   strOff of an entry that doesn't carry its item string
+     */
+    const uint32_t FGFS_GROUP_TABLE_NO_STRING = 0xffffffffU;
+
+
+    /**
+     *   FGFS_GROUP_TABLE_VERSION
+     *   Version of the packed group table
+     */
+    const uint32_t FGFS_GROUP_TABLE_VERSION = 1;
+
+
+    /**
+     *   An entry of a group table. fp is FgfsParDesc::hashItem of
+     *   the item; the item string, if carried, is
+     *   arena[strOff, strOff+strLen).
+     */
+    struct FgfsGroupTableEntry {
+        uint64_t fp;
+        FgfsId_t firstRank;
+        FgfsCount_t count;
+        uint32_t strOff;
+        uint32_t strLen;
+    };
+
+
+    /**
+     *   Read-only view of a packed group table. attach doesn't copy:
+     *   the view points into the buffer, which must outlive it.
+     *
+     *   Packed layout, native byte order:
+     *
+     *     uint32_t version, number of entries, arena bytes, reserved
+     *     FgfsGroupTableEntry entries[number of entries], sorted by fp
+     *     char arena[arena bytes]
+     */
+    class FgfsGroupTableView {
+    public:
+        FgfsGroupTableView();
+        ~FgfsGroupTableView();
+
+        /**
+         *   Attaches to a packed table
+         *
+         *   @param[in] buf packed table; 8-byte aligned as malloc
+         *                  returns it
+         *   @param[in] s size of buf
+         *
+         *   @return false if buf isn't a well-formed table
+         */
+        bool attach(const char *buf, size_t s);
+
+        size_t size() const;
+
+        const FgfsGroupTableEntry & entry(size_t i) const;
+
+        /**
+         *   Returns the entry of fp or NULL
+         */
+        const FgfsGroupTableEntry * find(uint64_t fp) const;
+
+        /**
+         *   Returns true if every entry carries its item string
+         */
+        bool hasStrings() const;
+
+        /**
+         *   Returns the item string of e or NULL if not carried
+         *
+         *   @param[in] e an entry of this view
+         *   @param[out] len length of the string
+         */
+        const char * getItem(const FgfsGroupTableEntry &e,
+                             uint32_t *len) const;
+
+    private:
+        friend class FgfsGroupTable;
+
+        const FgfsGroupTableEntry *mEntries;
+        size_t mSize;
+        const char *mArena;
+        size_t mArenaLen;
+    };
+
+
+    /**
+     *   Flat grouping table: the alternative to the string map of
+     *   FgfsParDesc used for reductions. Entries are keyed by a 64-bit
+     *   fingerprint of the item and kept sorted, so tables merge in
+     *   linear time and pack as two contiguous arrays. Item strings
+     *   live in a side arena and can be dropped when only the
+     *   fingerprints are needed.
+     */
+    class FgfsGroupTable {
+    public:
+        FgfsGroupTable();
+        ~FgfsGroupTable();
+
+        void clear();
+
+        /**
+         *   Appends an entry; call sort after the last add
+         *
+         *   @param[in] item the item
+         *   @param[in] firstRank first rank of the item
+         *   @param[in] count count of the item
+         *   @param[in] keepString whether to carry the item string
+         */
+        void add(const std::string &item,
+                 FgfsId_t firstRank,
+                 FgfsCount_t count,
+                 bool keepString);
+
+        /**
+         *   Sorts the entries by fingerprint and combines duplicates
+         */
+        void sort();
+
+        /**
+         *   Merges a sorted table into this one: the first rank is
+         *   the lower one and the counts add up
+         *
+         *   @param[in] o view of a sorted table
+         */
+        void merge(const FgfsGroupTableView &o);
+
+        void dropStrings();
+
+        FgfsGroupTableView view() const;
+
+        size_t size() const;
+
+        size_t packedSize() const;
+
+        size_t pack(char *buf, size_t s) const;
+
+        /**
+         *   Merges k sorted runs straight into a packed table, with
+         *   no intermediate table: entries stream out of a heap of
+         *   the runs' heads in fingerprint order. A first pass sizes
+         *   the table so that the buffer is exactly as large.
+         *
+         *   @param[in] runs views of the runs
+         *   @param[in] k number of runs
+         *   @param[in] keepStrings whether to carry item strings
+         *   @param[out] len size of the packed table
+         *
+         *   @return the malloc'd packed table, which the caller
+         *           frees, or NULL
+         */
+        static char * mergeRuns(const FgfsGroupTableView *runs,
+                                size_t k,
+                                bool keepStrings,
+                                size_t *len);
+
+    private:
+        static void walkRuns(const FgfsGroupTableView *runs,
+                             size_t k,
+                             bool keepStrings,
+                             FgfsGroupTableEntry *out,
+                             char *arena,
+                             size_t *nOut,
+                             size_t *arenaOut);
+
+        std::vector<FgfsGroupTableEntry> mEntries;
+        std::vector<char> mArena;
+    };
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // GROUP_TABLE_H
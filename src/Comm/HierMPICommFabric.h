@@ -0,0 +1,148 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef HIER_MPI_COMM_FABRIC_H
+#define HIER_MPI_COMM_FABRIC_H 1
+
+#include <mpi.h>
+#include "MPICommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *
+     * Defines the topology-aware MPI communication fabric. It is
+     * a drop-in MPICommFabric whose global operations run in two
+     * levels: within a node over a shared-memory communicator, and
+     * across nodes over a communicator of one leader per node. An
+     * allReduce is a node reduce, a leader allReduce and a node
+     * broadcast; a broadcast goes to the leaders and then within
+     * each node; the binomial reduceMap merges the node's tables at
+     * the leader and reduces across the leaders only.
+     *
+     * The lowest rank of a node leads it, so rank 0 of the fabric
+     * is the first leader and the root of every operation.
+     * Group-wise, nonblocking and hash-partitioned operations stay
+     * flat. With a single node, or one process per node, every
+     * operation is flat.
+     */
+    class HierMPICommFabric: public MPICommFabric {
+    public:
+        /**
+         *   HierMPICommFabric Ctor on MPI_COMM_WORLD, split by shared
+         *   memory. This is a collective.
+         *
+         */
+        HierMPICommFabric();
+
+        /**
+         *   HierMPICommFabric Ctor on a given communicator. This is
+         *   a collective over comm.
+         *
+         *   @param[in] comm the MPI communicator to operate on;
+         *                   the caller retains its ownership
+         *   @param[in] procsPerNode 0 to split by shared memory;
+         *                           otherwise consecutive ranks are
+         *                           grouped this many to a node
+         */
+        HierMPICommFabric(MPI_Comm comm, int procsPerNode);
+
+        /**
+         *   HierMPICommFabric Dtor
+         *
+         */
+        virtual ~HierMPICommFabric();
+
+        /**
+         *   Two-level reduceTable: the node's tables are merged at
+         *   the leader in one k-way pass, then reduced across the
+         *   leaders along a binomial tree
+         *
+         *   @param[in] pd an FgfsStatDesc object giving the rank and
+         *                 size
+         *   @param[in,out] table this process's table; on rank 0,
+         *                        the merged table of all
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceTable(FgfsParDesc &pd,
+                                 FgfsGroupTable &table) const;
+
+        /**
+         *   Return whether global operations run in two levels
+         *
+         *   @return a bool value
+         */
+        bool isHierarchical() const;
+
+        /**
+         *   Return the number of nodes
+         *
+         *   @return an int value
+         */
+        int getNodeCount() const;
+
+
+    protected:
+
+        /**
+         *   Node reduce, leader MPI_Allreduce and node broadcast
+         */
+        virtual int globalAllreduce(void *s,
+                                    void *r,
+                                    int count,
+                                    MPI_Datatype t,
+                                    MPI_Op op) const;
+
+        /**
+         *   Leader MPI_Bcast and node broadcast
+         */
+        virtual int globalBcast(void *b, int count, MPI_Datatype t) const;
+
+
+    private:
+
+        bool splitLevels(int procsPerNode);
+
+        HierMPICommFabric(const HierMPICommFabric &c);
+
+        /**
+         *   processes of this node; MPI_COMM_NULL if the split failed
+         */
+        MPI_Comm mNodeComm;
+
+        /**
+         *   node leaders; MPI_COMM_NULL unless this is one
+         */
+        MPI_Comm mLeaderComm;
+
+        int mNodeRank;
+        int mNodeSize;
+        int mNodeCount;
+
+        /**
+         *   true if there are several nodes and one of them has
+         *   several processes
+         */
+        bool mHier;
+
+        /**
+         *   flat fabric on mLeaderComm for reduceTable; NULL unless
+         *   this is a leader
+         */
+        MPICommFabric *mLeaderFab;
+    };
+  }
+}
+
+#endif // HIER_MPI_COMM_FABRIC_H
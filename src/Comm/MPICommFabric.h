@@ -6,6 +6,17 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Added allocNodeShared and MPINodeSharedSegment.
+ *        Oct 17 2026: Added reduceTable, globalAllreduce and
+ *                     globalBcast.
+ *        Oct 17 2026: Added flushBatch and the batch user op.
+ *        Oct 17 2026: The binomial reduceMap reduces an FgfsGroupTable.
+ *        Oct 17 2026: Added the hash-partitioned mapReduce engine.
+ *        Oct 17 2026: Added the group communicator cache.
+ *        Oct 17 2026: Added iallReduce, ibroadcast and MPICommRequest.
+ *        Oct 17 2026: Added the sparse bit set user op.
+ *        Oct 17 2026: Made the communicator a member and added
+ *                     splitNodeLocal and reduceMap.
  *        Jan 19 2011 DHA: File created.
  *
  */
@@ -16,6 +27,7 @@
 #include <map>
 #include <mpi.h>
 #include "CommFabric.h"
+#include "GroupTable.h"
 
 extern double accumTime;
 
@@ -29,6 +41,89 @@ namespace FastGlobalFileStatus {
      */
     const int FGFS_CUSTOM_REDUCTION_TAG = 49391;
 
+
+    /**
+     *   FGFS_COMM_CACHE_MAX
+     *   Defines the max number of group communicators that an
+     *   MPICommFabric keeps for reuse
+     */
+    const int FGFS_COMM_CACHE_MAX = 16;
+
+
+    /**
+     *   Enumerates the mapReduce engines of MPICommFabric
+     */
+    enum MPIMapReduceAlgo {
+        mra_binomial,           // reduce to rank 0 and broadcast the map
+        mra_hashPartition       // route items to owner ranks by hash
+    };
+
+
+    /**
+     *   MPI request handle returned by MPICommFabric::iallReduce and
+     *   ibroadcast. It owns the derived datatype and the group
+     *   communicator of the operation, if any, and frees them on
+     *   completion.
+     */
+    class MPICommRequest : public CommRequest {
+    public:
+
+        /**
+         *   MPICommRequest Ctor
+         *
+         *   @param[in] req an active MPI request
+         *   @param[in] type datatype to free on completion or
+         *                   MPI_DATATYPE_NULL
+         *   @param[in] comm communicator to free on completion or
+         *                   MPI_COMM_NULL
+         */
+        MPICommRequest(MPI_Request req, MPI_Datatype type, MPI_Comm comm);
+
+        virtual ~MPICommRequest();
+
+        virtual bool test();
+
+        virtual bool wait();
+
+    private:
+
+        void complete(bool rc);
+
+        MPI_Request mReq;
+        MPI_Datatype mType;
+        MPI_Comm mComm;
+        bool mDone;
+        bool mRc;
+    };
+
+
+    /**
+     *   Node-shared segment of MPICommFabric::allocNodeShared on an
+     *   MPI-3 shared memory window. publish is an MPI_Win_fence.
+     */
+    class MPINodeSharedSegment : public NodeSharedSegment {
+    public:
+
+        /**
+         *   MPINodeSharedSegment Ctor
+         *
+         *   @param[in] win a shared memory window, freed by the Dtor
+         *   @param[in] base the caller's mapping of the owner's part
+         *   @param[in] size the size of the owner's part
+         *   @param[in] owner true on the node leader
+         */
+        MPINodeSharedSegment(MPI_Win win, void *base, size_t size, bool owner);
+
+        virtual ~MPINodeSharedSegment();
+
+        virtual bool publish();
+
+    private:
+
+        MPI_Win mWin;
+    };
+
+
     /**
      *
      * Defines the MPI-based communication fabric class.
@@ -41,6 +136,14 @@ namespace FastGlobalFileStatus {
          */
         MPICommFabric();
 
+        /**
+         *   MPICommFabric Ctor on a given communicator
+         *
+         *   @param[in] comm the MPI communicator to operate on;
+         *                   the caller retains its ownership
+         */
+        MPICommFabric(MPI_Comm comm);
+
         /**
          *   MPICommFabric Dtor
          *
@@ -112,6 +215,44 @@ namespace FastGlobalFileStatus {
                                unsigned char *s,
                                FgfsCount_t len) const;
 
+        /**
+         *   MPI-based nonblocking allReduce on MPI_Iallreduce. Falls
+         *   back to the blocking allReduce without MPI-3.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[out] r receiver buffer
+         *   @param[in] len length of the buffer
+         *   @param[in] t ReduceDataType
+         *   @param[in] op ReduceOperator
+         *
+         *   @return a CommRequest object owned by the caller
+         */
+        virtual CommRequest *iallReduce(bool global,
+                                        FgfsParDesc &pd,
+                                        void *s,
+                                        void *r,
+                                        FgfsCount_t len,
+                                        ReduceDataType t,
+                                        ReduceOperator op) const;
+
+        /**
+         *   MPI-based nonblocking broadcast on MPI_Ibcast. Falls
+         *   back to the blocking broadcast without MPI-3.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[in] len length of the buffer
+         *
+         *   @return a CommRequest object owned by the caller
+         */
+        virtual CommRequest *ibroadcast(bool global,
+                                        FgfsParDesc &pd,
+                                        unsigned char *s,
+                                        FgfsCount_t len) const;
+
         /**
          *   MPI-based global grouping
          *
@@ -129,7 +270,12 @@ namespace FastGlobalFileStatus {
 
 
         /**
-         *   MPI-based mapReduce
+         *   MPI-based mapReduce. With mra_hashPartition, each item
+         *   is sent to the process that owns its hash, the owners
+         *   merge, and every process gets back the entries of its own
+         *   items only: pd's map becomes partial (see
+         *   FgfsParDesc::setPartialMap). Alias elimination still
+         *   needs the whole map and is done on the binomial path.
          *
          *   @param[in] global bool indicating global vs. group
          *   @param[out] pd an FgfsStatDesc object
@@ -155,6 +301,117 @@ namespace FastGlobalFileStatus {
          */
         virtual bool getRankSize(int *rank, int *size, bool *glMaster) const;
 
+        /**
+         *   MPI-based splitNodeLocal using MPI_Comm_split_type
+         *
+         *   @param[out] nodeFab node-local fabric
+         *   @param[out] leaderFab leader fabric; NULL if the caller
+         *                          isn't a node leader
+         *
+         *   @return a bool value
+         */
+        virtual bool splitNodeLocal(CommFabric **nodeFab,
+                                    CommFabric **leaderFab) const;
+
+        /**
+         *   MPI-based reduceMap
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in,out] pd an FgfsStatDesc object
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceMap(bool global,
+                               FgfsParDesc &pd,
+                               bool elimAlias) const;
+
+        /**
+         *   Reduces a sorted group table to rank 0 along a binomial
+         *   tree, the first phase of reduceMap. This is a global
+         *   collective.
+         *
+         *   @param[in] pd an FgfsStatDesc object giving the rank and
+         *                 size
+         *   @param[in,out] table this process's table; on rank 0,
+         *                        the merged table of all
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceTable(FgfsParDesc &pd,
+                                 FgfsGroupTable &table) const;
+
+        /**
+         *   MPI-based allocNodeShared using MPI_Win_allocate_shared
+         *   over the processes that share memory with the caller.
+         *   Returns NULL without MPI-3.
+         *
+         *   @param[in] len size of the segment; only the node
+         *                  leader's counts
+         *
+         *   @return a NodeSharedSegment object or NULL
+         */
+        virtual NodeSharedSegment *allocNodeShared(FgfsCount_t len) const;
+
+        /**
+         *   Selects the mapReduce engine; mra_binomial by default.
+         *   All processes must select the same engine. Fabrics from
+         *   splitNodeLocal inherit it.
+         *
+         *   @param[in] algo an MPIMapReduceAlgo value
+         */
+        void setMapReduceAlgo(MPIMapReduceAlgo algo);
+        MPIMapReduceAlgo getMapReduceAlgo() const;
+
+        /**
+         *   Frees the cached group communicators. Group-wise calls
+         *   split and cache them again on demand. This is a global
+         *   collective: all processes must call it at the same point.
+         */
+        void clearCommCache();
+
+        /**
+         *   Return the number of cached group communicators
+         *
+         *   @return a size_t value
+         */
+        size_t getCommCacheSize() const;
+
+        /**
+         *   Return the underlying communicator
+         *
+         *   @return an MPI communicator
+         */
+        MPI_Comm getComm() const;
+
+
+    protected:
+
+        /**
+         *   MPI_Allreduce over all processes of the fabric. Global
+         *   allReduce, flushBatch and the rest go through this.
+         *
+         *   @return an MPI error code
+         */
+        virtual int globalAllreduce(void *s,
+                                    void *r,
+                                    int count,
+                                    MPI_Datatype t,
+                                    MPI_Op op) const;
+
+        /**
+         *   MPI_Bcast from rank 0 over all processes of the fabric
+         *
+         *   @return an MPI error code
+         */
+        virtual int globalBcast(void *b, int count, MPI_Datatype t) const;
+
+        /**
+         *   Coalesces the global reductions and broadcasts of a batch
+         *   into one MPI_Allreduce of an FgfsBatchPacket
+         */
+        virtual bool flushBatch(std::vector<CommBatchOp> &ops) const;
+
 
     private:
 
@@ -162,8 +419,102 @@ namespace FastGlobalFileStatus {
 
         MPI_Op getMPIOp(ReduceOperator op) const;
 
+        static MPI_Op getSparseBitSetOp();
+
+        static MPI_Op getBatchOp();
+
+        bool getReduceTypeOp(ReduceDataType t,
+                             ReduceOperator op,
+                             FgfsCount_t *len,
+                             MPI_Datatype *myType,
+                             MPI_Op *myOp,
+                             bool *freeType) const;
+
+        /**
+         *   Returns the communicator of pd's group, from the cache
+         *   or split from mComm (or its async duplicate). The caller
+         *   frees it only if owned is set.
+         */
+        int getGroupComm(bool async,
+                         FgfsParDesc &pd,
+                         MPI_Comm *groupComm,
+                         bool *owned) const;
+
+        MPI_Comm getAsyncComm() const;
+
+        MPI_Comm getSharedComm() const;
+
+        bool hashPartitionMap(FgfsParDesc &pd, bool elimAlias) const;
+
         MPICommFabric(const CommFabric &c);
 
+        /**
+         *   communicator that this fabric operates on
+         */
+        MPI_Comm mComm;
+
+        /**
+         *   true if mComm was created by this layer and must be freed
+         */
+        bool mOwnComm;
+
+        /**
+         *   duplicate of mComm for nonblocking collectives,
+         *   created on first use
+         */
+        mutable MPI_Comm mAsyncComm;
+
+        /**
+         *   processes of mComm that share memory with this one, split
+         *   on first use by allocNodeShared
+         */
+        mutable MPI_Comm mSharedComm;
+
+        /**
+         *   grouping identity of a cached group communicator
+         */
+        struct GroupCommKey {
+            bool async;
+            uint64_t groupingHash;
+            FgfsId_t groupId;
+            int key;
+
+            bool operator<(const GroupCommKey &o) const;
+        };
+
+        struct GroupCommEntry {
+            MPI_Comm comm;
+            unsigned long lastUse;
+        };
+
+        /**
+         *   group communicators, evicted least recently used first
+         *   beyond FGFS_COMM_CACHE_MAX
+         */
+        mutable std::map<GroupCommKey, GroupCommEntry> mGroupComms;
+        mutable unsigned long mCommCacheClock;
+
+        /**
+         *   mapReduce engine
+         */
+        MPIMapReduceAlgo mMapReduceAlgo;
+
+        /**
+         *   table that send and receive reduce while reduceMap runs;
+         *   NULL otherwise, when they reduce pd itself
+         */
+        mutable FgfsGroupTable *mReduceTable;
+
+        /**
+         *   user op for REDUCE_SPARSE_BITSET, created on first use
+         */
+        static MPI_Op mSparseBitSetOp;
+
+        /**
+         *   user op for FgfsBatchPacket, created on first use
+         */
+        static MPI_Op mBatchOp;
+
     };
   }
 }
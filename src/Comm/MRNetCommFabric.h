@@ -6,6 +6,16 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Pipelined operations: added iallReduce,
+ *                     ibroadcast and MRNetCommRequest.
+ *        Oct 17 2026: Added MMT_op_allreduce_batch and flushBatch.
+ *        Oct 17 2026: Added uint64 and double reductions; numeric
+ *                     reductions are element-wise.
+ *        Oct 17 2026: Added the group-wise collectives.
+ *        Oct 17 2026: Map reductions carry FgfsGroupTables.
+ *        Oct 17 2026: Added the scatter map reductions.
+ *        Oct 17 2026: Added MMT_op_allreduce_sparse_bor.
+ *        Oct 17 2026: Added MMT_op_allreduce_char_max.
  *        Jul 7 2011 DHA: File created.
  *
  */
@@ -20,6 +30,7 @@ extern "C" {
 #include "mrnet/MRNet.h"
 #include "CommFabric.h"
 #include <map>
+#include <deque>
 #include <vector>
 #include <string>
 
@@ -63,13 +74,6 @@ namespace FastGlobalFileStatus {
     const char FGFS_DOWN_FILTER_FN_NAME[] = "FGFSFilterDown";
 
 
-    /**
-     *   FGFS_DOWN_FILTER_SO_NAME
-     *   Defines a upstream filter SO used for custom reduction
-     */
-    const unsigned char FGFS_4_BYTES[] = {'F', 'G', 'F', 'S'};
-
-
     enum MRNetMsgType {
         MMT_op_init = FGFS_MRNET_TAG_BASE,
         MMT_op_broadcast_bytes,
@@ -83,15 +87,163 @@ namespace FastGlobalFileStatus {
         MMT_op_allreduce_map,
         MMT_op_allreduce_map_elim_alias,
         MMT_debug_mpir,
+        MMT_op_allreduce_char_max,
+        MMT_op_allreduce_sparse_bor,
+        MMT_op_allreduce_map_scatter,
+        MMT_op_allreduce_map_scatter_elim_alias,
+        MMT_op_group_allreduce,
+        MMT_op_group_broadcast,
+        MMT_op_allreduce_uint64_max,
+        MMT_op_allreduce_uint64_min,
+        MMT_op_allreduce_uint64_sum,
+        MMT_op_allreduce_double_max,
+        MMT_op_allreduce_double_min,
+        MMT_op_allreduce_double_sum,
+        MMT_op_allreduce_batch,
         MMT_place_holder
     };
 
 
+    /**
+     *   Maps an element-wise reduction message type to the type and
+     *   the operator the reduction kernels take; the filter and the
+     *   front-end both reduce through it.
+     *
+     *   @return false if m isn't an element-wise reduction
+     */
+    inline bool
+    getMRNetReduceTypeOp(MRNetMsgType m, ReduceDataType *t, ReduceOperator *op)
+    {
+        static const struct {
+            MRNetMsgType m;
+            ReduceDataType t;
+            ReduceOperator op;
+        } ops[] = {
+            { MMT_op_allreduce_int_max, REDUCE_INT, REDUCE_MAX },
+            { MMT_op_allreduce_int_min, REDUCE_INT, REDUCE_MIN },
+            { MMT_op_allreduce_int_sum, REDUCE_INT, REDUCE_SUM },
+            { MMT_op_allreduce_long_long_max, REDUCE_LONG_LONG_INT, REDUCE_MAX },
+            { MMT_op_allreduce_long_long_min, REDUCE_LONG_LONG_INT, REDUCE_MIN },
+            { MMT_op_allreduce_long_long_sum, REDUCE_LONG_LONG_INT, REDUCE_SUM },
+            { MMT_op_allreduce_uint64_max, REDUCE_UINT64, REDUCE_MAX },
+            { MMT_op_allreduce_uint64_min, REDUCE_UINT64, REDUCE_MIN },
+            { MMT_op_allreduce_uint64_sum, REDUCE_UINT64, REDUCE_SUM },
+            { MMT_op_allreduce_double_max, REDUCE_DOUBLE, REDUCE_MAX },
+            { MMT_op_allreduce_double_min, REDUCE_DOUBLE, REDUCE_MIN },
+            { MMT_op_allreduce_double_sum, REDUCE_DOUBLE, REDUCE_SUM },
+            { MMT_op_allreduce_char_max, REDUCE_CHAR_ARRAY, REDUCE_MAX }
+        };
+        size_t k;
+
+        for (k=0; k < sizeof(ops)/sizeof(ops[0]); ++k) {
+            if (ops[k].m == m) {
+                (*t) = ops[k].t;
+                (*op) = ops[k].op;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    /**
+     *   A reduction the front-end has posted whose upstream wave
+     *   hasn't come in yet. Waves come in in the order the
+     *   operations were posted.
+     */
+    struct MRNetPendingWave {
+        uint32_t seq;
+        MRNetMsgType oPType;
+        unsigned char *sendBuf;
+        unsigned int sendLen;
+    };
+
+
+    /**
+     *   The result of an operation, in but not yet taken by the
+     *   request that waits on it
+     */
+    struct MRNetResult {
+        int tag;
+        bool rc;
+        unsigned char *buf;
+        unsigned int len;
+    };
+
+
+    class MRNetCommFabric;
+
+
+    /**
+     *   Request handle returned by MRNetCommFabric::iallReduce and
+     *   ibroadcast. Testing or waiting on it drives the stream until
+     *   the result with its sequence number has come in; results of
+     *   other outstanding operations are kept for their requests.
+     */
+    class MRNetCommRequest : public CommRequest {
+    public:
+
+        /**
+         *   MRNetCommRequest Ctor
+         *
+         *   @param[in] fab the fabric that posted the operation
+         *   @param[in] seq sequence number of the operation
+         *   @param[in] oPType message type of the operation
+         *   @param[out] r receive buffer
+         *   @param[in] t ReduceDataType of r
+         *   @param[in] fullLen size of r in bytes
+         */
+        MRNetCommRequest(const MRNetCommFabric *fab,
+                         uint32_t seq,
+                         MRNetMsgType oPType,
+                         void *r,
+                         ReduceDataType t,
+                         unsigned int fullLen);
+
+        virtual ~MRNetCommRequest();
+
+        virtual bool test();
+
+        virtual bool wait();
+
+    private:
+
+        bool progress(bool block);
+
+        const MRNetCommFabric *mFab;
+        uint32_t mSeq;
+        MRNetMsgType mOPType;
+        void *mR;
+        ReduceDataType mType;
+        unsigned int mFullLen;
+        bool mDone;
+        bool mRc;
+    };
+
+
     /**
      *
      * Defines the MRNet-based communication fabric class.
+     *
+     * Group-wise (non-global) collectives run on the whole network
+     * as segmented reductions: each process sends its data as the
+     * FgfsGroupSegments segment of its group, the filters combine
+     * segments of the same group and every process takes its group's
+     * segment from the result. As on MPI, they are global until a
+     * multi-group grouping is done.
+     *
+     * Operations are pipelined. Every process numbers its operations
+     * in the order it calls them, which is the same everywhere. A
+     * back-end sends its contribution up as soon as it posts an
+     * operation, and the front-end sends each result down as soon
+     * as the wave of the operation comes in. The sequence number
+     * goes in the packet. Several nonblocking operations can be in
+     * flight on the one stream.
      */
     class MRNetCommFabric: public CommFabric {
+        friend class MRNetCommRequest;
+
     public:
 
         /**
@@ -153,7 +305,37 @@ namespace FastGlobalFileStatus {
                                FgfsCount_t len) const;
 
         /**
-         *   MRNet-based grouping
+         *   MRNet-based iallReduce. A back-end sends its data up right
+         *   away. Group-wise and batched operations complete at once,
+         *   as in the default implementation.
+         *
+         *   @return a CommRequest object owned by the caller;
+         *           NULL if the operation couldn't be started
+         */
+        virtual CommRequest *iallReduce(bool global,
+                                        FgfsParDesc &pd,
+                                        void *s,
+                                        void *r,
+                                        FgfsCount_t len,
+                                        ReduceDataType t,
+                                        ReduceOperator op) const;
+
+        /**
+         *   MRNet-based ibroadcast. The front-end's request is
+         *   complete once its bytes are sent.
+         *
+         *   @return a CommRequest object owned by the caller;
+         *           NULL if the operation couldn't be started
+         */
+        virtual CommRequest *ibroadcast(bool global,
+                                        FgfsParDesc &pd,
+                                        unsigned char *s,
+                                        FgfsCount_t len) const;
+
+        /**
+         *   MRNet-based grouping. With gm_scatter, the front-end
+         *   sends down a group table without item strings in place
+         *   of the whole map since the downstream is a broadcast.
          *
          *   @param[in] global bool indicating global vs. group
          *   @param[out] pd an FgfsStatDesc object
@@ -169,7 +351,9 @@ namespace FastGlobalFileStatus {
 
 
         /**
-         *   MRNet-based mapReduce
+         *   MRNet-based mapReduce. Group-wise, the items are tagged
+         *   with the group id for the reduction and pd gets the map
+         *   of this process's group.
          *
          *   @param[in] global bool indicating global vs. group
          *   @param[out] pd an FgfsStatDesc object
@@ -210,10 +394,43 @@ namespace FastGlobalFileStatus {
         virtual void *getChannel();
 
 
+    protected:
+
+        /**
+         *   Sends the global reductions and broadcasts of a batch up
+         *   the tree as one FgfsBatchPacket
+         */
+        virtual bool flushBatch(std::vector<CommBatchOp> &ops) const;
+
+
     private:
 
         MRNetCommFabric(const CommFabric &c);
 
+        bool reduceItems(bool global,
+                         FgfsParDesc &pd,
+                         std::vector<std::string> &itemList,
+                         bool elimAlias,
+                         bool scatter) const;
+
+        bool reduceGroupItems(FgfsParDesc &pd,
+                              std::vector<std::string> &itemList) const;
+
+        bool groupCollective(FgfsParDesc &pd,
+                             void *s,
+                             void *r,
+                             unsigned int byteLen,
+                             ReduceDataType t,
+                             ReduceOperator op,
+                             MRNetMsgType oPType) const;
+
+        bool isGroupWise(bool global, FgfsParDesc &pd) const;
+
+        bool unpackReducedMap(FgfsParDesc &pd,
+                              unsigned char *buf,
+                              unsigned int len,
+                              bool elimAlias) const;
+
         bool allReduceFE(unsigned char *sendBuf,
                          unsigned char **recvBuf,
                          unsigned int sndByteLen,
@@ -226,6 +443,38 @@ namespace FastGlobalFileStatus {
                          unsigned int *rcvByteLen,
                          MRNetMsgType oPType) const;
 
+        bool postWaveFE(unsigned char *sendBuf,
+                        unsigned int sndByteLen,
+                        MRNetMsgType oPType,
+                        uint32_t *seq) const;
+
+        bool postWaveBE(unsigned char *sendBuf,
+                        unsigned int sndByteLen,
+                        MRNetMsgType oPType,
+                        uint32_t *seq) const;
+
+        /**
+         *   Takes the result of operation seq, receiving packets until
+         *   it is in if block. With !block, done is false while the
+         *   result hasn't come in.
+         *
+         *   @param[out] recvBuf malloc'd result the caller frees
+         */
+        bool completeOp(uint32_t seq,
+                        MRNetMsgType oPType,
+                        bool block,
+                        bool *done,
+                        unsigned char **recvBuf,
+                        unsigned int *rcvByteLen) const;
+
+        /**
+         *   Receives one packet: on the front-end a reduced wave,
+         *   whose result it sends down, on a back-end a result
+         *
+         *   @param[out] got false if !block and nothing was there
+         */
+        bool receiveOne(bool block, bool *got) const;
+
         bool reduceFinal(unsigned char *finalBuf,
                          unsigned int finalBufLen,
                          unsigned char *mergedBuf,
@@ -237,6 +486,10 @@ namespace FastGlobalFileStatus {
         unsigned int computeByteLength(ReduceDataType t,
                          FgfsCount_t len) const;
 
+        bool checkRecvLen(ReduceDataType t,
+                         unsigned int recvLen,
+                         unsigned int fullLen) const;
+
         MRNetMsgType getMRNetMsgType(ReduceDataType t,
                          ReduceOperator op) const;
 
@@ -246,6 +499,21 @@ namespace FastGlobalFileStatus {
         static FgfsCount_t mSizeCache;
         static MRN::Network *mNetwork;
         static MRN::Stream *mStream;
+
+        /**
+         *   sequence number of the next operation
+         */
+        static uint32_t mNextSeq;
+
+        /**
+         *   front-end: posted reductions waiting for their wave
+         */
+        static std::deque<MRNetPendingWave> mPendingWaves;
+
+        /**
+         *   results in but not yet taken, by sequence number
+         */
+        static std::map<uint32_t, MRNetResult> mResults;
     };
 
   } // CommLayer namespace
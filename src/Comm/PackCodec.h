@@ -0,0 +1,93 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef PACK_CODEC_H
+#define PACK_CODEC_H 1
+
+extern "C" {
+#include <stdint.h>
+#include <stddef.h>
+}
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   Byte-level codecs of the packed formats: unsigned LEB128
+     *   varints and a small LZ77 block compressor.
+     *
+     *   A compressed block is a series of sequences, each of
+     *
+     *     varint literal length, literal bytes,
+     *     varint match length - PACK_CODEC_MIN_MATCH, varint offset
+     *
+     *   where the last sequence ends after its literals. The decoder
+     *   makes a single pass over the block and copies matches from
+     *   what it has already written.
+     */
+    class PackCodec {
+    public:
+
+        static const size_t PACK_CODEC_MIN_MATCH = 4;
+
+        static size_t varintSize(uint64_t v);
+
+        /**
+         *   Writes v at p and returns the byte after it
+         */
+        static char * putVarint(char *p, uint64_t v);
+
+        /**
+         *   Reads a varint at p, not reading at or beyond end
+         *
+         *   @return the byte after the varint or NULL if truncated
+         */
+        static const char * getVarint(const char *p,
+                                      const char *end,
+                                      uint64_t *v);
+
+        /**
+         *   Returns the max size of a compressed block of n bytes
+         */
+        static size_t lzBound(size_t n);
+
+        /**
+         *   Compresses src into dst
+         *
+         *   @param[in] src bytes to compress
+         *   @param[in] n number of bytes
+         *   @param[out] dst compressed block
+         *   @param[in] cap size of dst
+         *
+         *   @return size of the block or 0 if it doesn't fit in cap
+         */
+        static size_t lzCompress(const char *src,
+                                 size_t n,
+                                 char *dst,
+                                 size_t cap);
+
+        /**
+         *   Decompresses a block into exactly outLen bytes
+         *
+         *   @return false if the block is malformed
+         */
+        static bool lzDecompress(const char *src,
+                                 size_t n,
+                                 char *dst,
+                                 size_t outLen);
+    };
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // PACK_CODEC_H
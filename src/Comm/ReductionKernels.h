@@ -0,0 +1,178 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef REDUCTION_KERNELS_H
+#define REDUCTION_KERNELS_H 1
+
+extern "C" {
+#include <stdint.h>
+#include <stddef.h>
+}
+
+#include "CommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   Element-wise reduction kernels shared by the fabrics and the
+     *   MRNet filter. Each reduces in into acc, n elements of T;
+     *   a loop per operator keeps them simple enough to vectorize.
+     *
+     *   @return false if op isn't defined for T
+     */
+    template <typename T>
+    inline bool
+    reduceElements(ReduceOperator op, T *acc, const T *in, size_t n)
+    {
+        size_t j;
+
+        switch (op) {
+        case REDUCE_MAX:
+            for (j=0; j < n; ++j) {
+                acc[j] = (in[j] > acc[j])? in[j] : acc[j];
+            }
+            break;
+
+        case REDUCE_MIN:
+            for (j=0; j < n; ++j) {
+                acc[j] = (in[j] < acc[j])? in[j] : acc[j];
+            }
+            break;
+
+        case REDUCE_SUM:
+            for (j=0; j < n; ++j) {
+                acc[j] += in[j];
+            }
+            break;
+
+        default:
+            return false;
+        }
+
+        return true;
+    }
+
+
+    /**
+     *   Integral types also OR
+     */
+    template <typename T>
+    inline bool
+    reduceIntegralElements(ReduceOperator op, T *acc, const T *in, size_t n)
+    {
+        size_t j;
+
+        if (op != REDUCE_BOR) {
+            return reduceElements<T>(op, acc, in, n);
+        }
+
+        for (j=0; j < n; ++j) {
+            acc[j] |= in[j];
+        }
+
+        return true;
+    }
+
+
+    /**
+     *   Returns the element size of t, 0 if t isn't an element type
+     */
+    inline size_t
+    reduceElementSize(ReduceDataType t)
+    {
+        size_t s = 0;
+
+        switch (t) {
+        case REDUCE_INT:
+            s = sizeof(int);
+            break;
+
+        case REDUCE_LONG_LONG_INT:
+            s = sizeof(long long int);
+            break;
+
+        case REDUCE_UINT64:
+            s = sizeof(uint64_t);
+            break;
+
+        case REDUCE_DOUBLE:
+            s = sizeof(double);
+            break;
+
+        case REDUCE_CHAR_ARRAY:
+            s = sizeof(unsigned char);
+            break;
+
+        default:
+            break;
+        }
+
+        return s;
+    }
+
+
+    /**
+     *   Reduces byteLen bytes of in into acc as elements of t. Both
+     *   must be aligned for t, as malloc'd buffers are.
+     *
+     *   @return false if t and op don't make a reduction or byteLen
+     *           isn't a whole number of elements
+     */
+    inline bool
+    reduceTyped(ReduceDataType t,
+                ReduceOperator op,
+                void *acc,
+                const void *in,
+                size_t byteLen)
+    {
+        size_t s = reduceElementSize(t);
+
+        if (!s || byteLen % s) {
+            return false;
+        }
+
+        switch (t) {
+        case REDUCE_INT:
+            return reduceIntegralElements<int>(op, (int *) acc,
+                       (const int *) in, byteLen / s);
+
+        case REDUCE_LONG_LONG_INT:
+            return reduceIntegralElements<long long int>(op,
+                       (long long int *) acc,
+                       (const long long int *) in, byteLen / s);
+
+        case REDUCE_UINT64:
+            return reduceIntegralElements<uint64_t>(op, (uint64_t *) acc,
+                       (const uint64_t *) in, byteLen / s);
+
+        case REDUCE_DOUBLE:
+            return reduceElements<double>(op, (double *) acc,
+                       (const double *) in, byteLen / s);
+
+        case REDUCE_CHAR_ARRAY:
+            return reduceIntegralElements<unsigned char>(op,
+                       (unsigned char *) acc,
+                       (const unsigned char *) in, byteLen);
+
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // REDUCTION_KERNELS_H
@@ -0,0 +1,337 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef SIM_COMM_FABRIC_H
+#define SIM_COMM_FABRIC_H 1
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include <map>
+#include <vector>
+#include "CommFabric.h"
+#include "GroupTable.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   FGFS_SIM_MAX_OPS
+     *   Defines the max number of collectives a simulated program
+     *   may issue; a program that issues more is taken to loop
+     */
+    const int FGFS_SIM_MAX_OPS = 1024;
+
+
+    /**
+     *   A run of consecutive virtual ranks, [first, first+count),
+     *   whose inputs are alike, e.g., the processes of a node or of
+     *   a scalable unit that see the same file server
+     */
+    struct SimRankClass {
+        FgfsId_t first;
+        FgfsCount_t count;
+    };
+
+
+    enum SimOpKind {
+        so_allReduce = 0,
+        so_broadcast,
+        so_reduceMap
+    };
+
+
+    /**
+     *   Modeled cost of a simulated collective. Bytes and messages
+     *   count every edge of the tree; hops is the number of
+     *   messages on the longest path, e.g., down and up the tree
+     *   for an allReduce.
+     */
+    struct SimOpStat {
+        SimOpKind kind;
+        uint64_t messages;
+        uint64_t bytes;
+        uint64_t maxMessage;
+        int hops;
+    };
+
+
+    /**
+     *   A collective program that SimCommFabric runs as each class
+     *   of virtual ranks. run is called several times a class and
+     *   must do the same thing each time, given the same results
+     *   from the fabric. What a rank contributes must depend on its
+     *   class only, not on its rank number, except for the first
+     *   ranks of its grouping map entries.
+     */
+    class SimRankProgram {
+    public:
+
+        virtual ~SimRankProgram();
+
+        /**
+         *   Runs the program as the first rank of a class
+         *
+         *   @param[in] cls the index of the class
+         *
+         *   @return a bool value
+         */
+        virtual bool run(size_t cls) = 0;
+    };
+
+
+    /**
+     *
+     * Defines the simulation fabric class. It models P virtual
+     * ranks, up to millions, inside one process so that the
+     * algorithms above the fabric can be studied at scale without
+     * a machine. The ranks are given as classes of alike ranks and
+     * the program runs once a class, never once a rank.
+     *
+     * simulate replays the program: to find the result of the
+     * k-th collective, every class runs the program, which gets the
+     * known results of the first k-1 and contributes to the k-th;
+     * the contributions are reduced, weighted by the size of the
+     * class for a sum, and the program's later results are
+     * placeholders. This repeats until a round issues no
+     * collective, in which each class has run with real results
+     * throughout. Each collective is charged the messages of a
+     * tree of the given fan-out: 2 is the binomial tree of
+     * MPICommFabric; the tables of reduceMap are merged block by
+     * block as the tree would, for real message sizes.
+     */
+    class SimCommFabric: public CommFabric {
+    public:
+
+        /**
+         *   SimCommFabric Ctor
+         *
+         *   @param[in] size number of virtual ranks
+         *   @param[in] fanOut fan-out of the modeled tree; 2 for
+         *                     a binomial tree
+         */
+        SimCommFabric(FgfsCount_t size, int fanOut);
+
+        /**
+         *   SimCommFabric Dtor
+         *
+         */
+        virtual ~SimCommFabric();
+
+        /**
+         *   Sets the classes of virtual ranks
+         *
+         *   @param[in] classes runs that cover 0 to size-1 in order
+         *
+         *   @return false if they don't
+         */
+        bool setClasses(const std::vector<SimRankClass> &classes);
+
+        const std::vector<SimRankClass> & getClasses() const;
+
+        /**
+         *   Runs prog as all of the virtual ranks
+         *
+         *   @param[in] prog the program
+         *
+         *   @return false if the classes issued different
+         *           collectives or the last runs failed
+         */
+        bool simulate(SimRankProgram &prog);
+
+        /**
+         *   Return the modeled cost of each collective of the last
+         *   simulate, in order
+         *
+         *   @return a vector of SimOpStat
+         */
+        const std::vector<SimOpStat> & getOpStats() const;
+
+        /**
+         *   Return the depth of the modeled tree over n ranks
+         *
+         *   @return an int value
+         */
+        int getTreeDepth(FgfsCount_t n) const;
+
+        /**
+         *   Simulated allReduce
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[out] r receiver buffer
+         *   @param[in] len length of the buffer
+         *   @param[in] t ReduceDataType
+         *   @param[in] op ReduceOperator
+         *
+         *   @return a bool value
+         */
+        virtual bool allReduce(bool global,
+                               FgfsParDesc &pd,
+                               void *s,
+                               void *r,
+                               FgfsCount_t len,
+                               ReduceDataType t,
+                               ReduceOperator op) const;
+
+        /**
+         *   Simulated broadcast
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[in] len length of the buffer
+         *
+         *   @return a bool value
+         */
+        virtual bool broadcast(bool global,
+                               FgfsParDesc &pd,
+                               unsigned char *s,
+                               FgfsCount_t len) const;
+
+        /**
+         *   Simulated global grouping. With gm_scatter, a class gets
+         *   its own entry only and is charged for that much.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[out] pd an FgfsStatDesc object
+         *   @param[in] item data item to group
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool grouping(bool global,
+                              FgfsParDesc &pd,
+                              std::string &item,
+                              bool elimAlias) const;
+
+        /**
+         *   Simulated mapReduce
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[out] pd an FgfsStatDesc object
+         *   @param[in] itemList a item list containing unique item (vector type)
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool mapReduce(bool global,
+                               FgfsParDesc &pd,
+                               std::vector<std::string> &itemList,
+                               bool elimAlias) const;
+
+        /**
+         *   The rank is the first of the running class
+         *
+         *   @param[out] rank pointer to an int
+         *   @param[out] size pointer to an int
+         *   @param[out] glMaster is this rank the global master
+         *
+         *   @return a bool value
+         */
+        virtual bool getRankSize(int *rank, int *size, bool *glMaster) const;
+
+        /**
+         *   Simulated reduceMap. An entry counts once for each rank
+         *   of the class that contributes it.
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in,out] pd an FgfsStatDesc object
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceMap(bool global,
+                               FgfsParDesc &pd,
+                               bool elimAlias) const;
+
+
+    private:
+
+        SimCommFabric(const SimCommFabric &c);
+
+        /**
+         *   Result of a collective, per group for group-wise ones
+         */
+        struct SimResult {
+            std::map<FgfsId_t, std::vector<unsigned char> > bufs;
+            std::map<std::string, ReduceDesc> map;
+            uint64_t entryHashSum;
+        };
+
+        /**
+         *   Returns true if the running class is to contribute to
+         *   the op; sets *res to the op's result if it is known
+         */
+        bool nextOp(SimOpKind kind, const SimResult **res) const;
+
+        void finishOp();
+
+        /**
+         *   reduceMap, or the exchange of grouping that delivers the
+         *   caller's entry only if scatter
+         */
+        bool exchangeMap(FgfsParDesc &pd, bool elimAlias, bool scatter) const;
+
+        FgfsId_t groupKey(bool global, FgfsParDesc &pd) const;
+
+        int findClass(uint64_t rank) const;
+
+        /**
+         *   Charges st with the merge of the tables of the ranks of
+         *   [first, first+span) to first and sets out to the merged
+         *   table, whose counts don't matter
+         */
+        void blockVolume(uint64_t first,
+                         uint64_t span,
+                         FgfsGroupTable &out,
+                         SimOpStat &st) const;
+
+        FgfsCount_t mSize;
+
+        int mFanOut;
+
+        std::vector<SimRankClass> mClasses;
+
+        std::vector<SimOpStat> mStats;
+
+        /**
+         *   replay state: the results known so far, the collective
+         *   to contribute to and the running class
+         */
+        std::vector<SimResult> mResults;
+        size_t mTarget;
+        size_t mClass;
+        mutable size_t mSeq;
+        mutable size_t mContributed;
+        mutable bool mFailed;
+
+        /**
+         *   what the classes contribute to the target collective
+         */
+        mutable SimOpKind mKind;
+        mutable size_t mBytes;
+        mutable ReduceDataType mType;
+        mutable ReduceOperator mOp;
+        mutable bool mElimAlias;
+        mutable bool mScatter;
+        mutable std::map<FgfsId_t, std::vector<unsigned char> > mAcc;
+        mutable std::map<FgfsId_t, FgfsCount_t> mGroupSizes;
+        mutable std::vector<FgfsGroupTable> mClassTables;
+        mutable FgfsGroupTable mAccTable;
+    };
+  }
+}
+
+#endif // SIM_COMM_FABRIC_H
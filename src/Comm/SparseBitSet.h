@@ -0,0 +1,119 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef SPARSE_BIT_SET_H
+#define SPARSE_BIT_SET_H 1
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include "DistDesc.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   Wire format of a sparse bit set: a sorted list of the indices
+     *   of the set bits. It is an array of uint32_t words:
+     *
+     *     [0] user header bits, merged with a bitwise OR
+     *     [1] capacity: the max number of indices the set can hold
+     *     [2] number of indices | SPARSE_BIT_SET_OVERFLOW
+     *     [3 .. 3+capacity) sorted, unique bit indices
+     *
+     *   The union of two sets is their merged list. Once a union would
+     *   exceed the capacity, the set is marked as overflown and the
+     *   caller has to fall back to the dense bitmap. Overflow absorbs,
+     *   so the union stays associative and commutative and can be used
+     *   as an MPI user op or in MRNet filters. A set can be sent in
+     *   compact form, i.e., truncated after its last index.
+     */
+    class SparseBitSet {
+    public:
+
+        static const uint32_t SPARSE_BIT_SET_HEADER_WORDS = 3;
+
+        static const uint32_t SPARSE_BIT_SET_OVERFLOW = 0x80000000U;
+
+        /**
+         *   Returns the number of words of a set with the capacity
+         *
+         *   @param[in] capacity max number of indices
+         *
+         *   @return number of uint32_t words
+         */
+        static uint32_t wireWords(uint32_t capacity);
+
+        /**
+         *   Encodes a dense bitmap. Marks the set as overflown if
+         *   more than capacity bits are set.
+         *
+         *   @param[in] dense dense bitmap; bit i lives in byte i/8
+         *   @param[in] nbits number of bits in the bitmap
+         *   @param[in] hdr user header bits
+         *   @param[out] wire wireWords(capacity) words
+         *   @param[in] capacity max number of indices
+         *
+         *   @return false if the set overflows
+         */
+        static bool encode(const unsigned char *dense,
+                           uint32_t nbits,
+                           uint32_t hdr,
+                           uint32_t *wire,
+                           uint32_t capacity);
+
+        /**
+         *   Decodes a set into a dense bitmap of nbytes bytes
+         *
+         *   @param[in] wire a set in full or compact form
+         *   @param[out] dense dense bitmap
+         *   @param[in] nbytes size of the dense bitmap
+         *
+         *   @return false if the set overflowed or doesn't fit
+         */
+        static bool decode(const uint32_t *wire,
+                           unsigned char *dense,
+                           uint32_t nbytes);
+
+        /**
+         *   Merges in into inout. inout must be in full form; in can
+         *   be in compact form.
+         *
+         *   @param[in] in a set
+         *   @param[in,out] inout a set that receives the union
+         */
+        static void merge(const uint32_t *in, uint32_t *inout);
+
+        /**
+         *   Returns the number of words of the set in compact form
+         *
+         *   @param[in] wire a set
+         *
+         *   @return number of uint32_t words
+         */
+        static uint32_t compactWords(const uint32_t *wire);
+
+        static uint32_t header(const uint32_t *wire);
+
+        static uint32_t capacity(const uint32_t *wire);
+
+        static uint32_t count(const uint32_t *wire);
+
+        static bool isOverflown(const uint32_t *wire);
+    };
+
+  } // CommLayer namespace
+
+} // FastGlobalFileStatus namespace
+
+#endif // SPARSE_BIT_SET_H
@@ -0,0 +1,270 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef THREAD_COMM_FABRIC_H
+#define THREAD_COMM_FABRIC_H 1
+
+#include <vector>
+#include "CommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+  namespace CommLayer {
+
+    /**
+     *   FGFS_THREAD_BARRIER_SPINS
+     *   Defines how many times a thread polls a ThreadCommWorld
+     *   barrier before it starts yielding the processor
+     */
+    const int FGFS_THREAD_BARRIER_SPINS = 1024;
+
+
+    /**
+     *   The threads of one process that a ThreadCommFabric operates
+     *   on: a barrier and one published slot per thread. The
+     *   creator owns it and must keep it alive until every fabric
+     *   on it is gone.
+     */
+    class ThreadCommWorld {
+    public:
+
+        /**
+         *   ThreadCommWorld Ctor
+         *
+         *   @param[in] size number of threads; each one is a rank
+         */
+        ThreadCommWorld(int size);
+
+        ~ThreadCommWorld();
+
+        int getSize() const;
+
+        /**
+         *   Blocks until all of the threads have arrived. It orders
+         *   memory: what a thread wrote before the barrier, all of
+         *   the others see after it.
+         */
+        void barrier();
+
+        /**
+         *   Makes p the slot of rank; the others read it after the
+         *   next barrier
+         */
+        void publish(int rank, const void *p);
+
+        const void *getSlot(int rank) const;
+
+    private:
+
+        ThreadCommWorld(const ThreadCommWorld &w);
+
+        int mSize;
+
+        volatile int mArrived;
+
+        volatile unsigned int mGeneration;
+
+        std::vector<const void *> mSlots;
+    };
+
+
+    /**
+     *   Node-shared segment of ThreadCommFabric::allocNodeShared.
+     *   The threads of a process share memory already: rank 0
+     *   mallocs the segment and the others use its pointer. publish
+     *   is a barrier.
+     */
+    class ThreadNodeSharedSegment : public NodeSharedSegment {
+    public:
+
+        /**
+         *   ThreadNodeSharedSegment Ctor
+         *
+         *   @param[in] world the threads sharing the segment
+         *   @param[in] base the segment; rank 0 frees it
+         *   @param[in] size the size of the segment
+         *   @param[in] owner true on rank 0
+         */
+        ThreadNodeSharedSegment(ThreadCommWorld *world,
+                                void *base,
+                                size_t size,
+                                bool owner);
+
+        virtual ~ThreadNodeSharedSegment();
+
+        virtual bool publish();
+
+    private:
+
+        ThreadCommWorld *mWorld;
+    };
+
+
+    /**
+     *
+     * Defines the in-process communication fabric class. Each of N
+     * threads of a process constructs its own ThreadCommFabric on a
+     * shared ThreadCommWorld and acts as a rank. A collective
+     * publishes the caller's arguments in the world's slot and
+     * meets the other threads at a barrier; each thread then reads
+     * the others' buffers in place, with no message and no copy
+     * beyond its own result, and a second barrier releases the
+     * buffers. The reduction runs in rank order on every thread, so
+     * all of them get bit-identical results, floating point
+     * included. reduceMap merges the threads' group tables pairwise
+     * along a binomial tree, one barrier a level.
+     *
+     * It needs neither MPI nor MRNet, which makes it a fast local
+     * engine for hybrid applications and for single-box tests.
+     * The static state of SyncGlobalFileStatus and the classifiers
+     * is per process, though, so their threads can't each use a
+     * fabric of their own yet.
+     */
+    class ThreadCommFabric: public CommFabric {
+    public:
+
+        /**
+         *   ThreadCommFabric Ctor
+         *
+         *   @param[in] world the threads to operate on; the caller
+         *                    retains its ownership
+         *   @param[in] rank the calling thread's rank in world
+         */
+        ThreadCommFabric(ThreadCommWorld *world, int rank);
+
+        /**
+         *   ThreadCommFabric Dtor
+         *
+         */
+        virtual ~ThreadCommFabric();
+
+        /**
+         *   Thread-based allReduce
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[out] r receiver buffer
+         *   @param[in] len length of the buffer
+         *   @param[in] t ReduceDataType
+         *   @param[in] op ReduceOperator
+         *
+         *   @return a bool value
+         */
+        virtual bool allReduce(bool global,
+                               FgfsParDesc &pd,
+                               void *s,
+                               void *r,
+                               FgfsCount_t len,
+                               ReduceDataType t,
+                               ReduceOperator op) const;
+
+        /**
+         *   Thread-based broadcast from rank 0 or, group-wise, from
+         *   the representative of the group
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in] pd an FgfsStatDesc object
+         *   @param[in] s source buffer
+         *   @param[in] len length of the buffer
+         *
+         *   @return a bool value
+         */
+        virtual bool broadcast(bool global,
+                               FgfsParDesc &pd,
+                               unsigned char *s,
+                               FgfsCount_t len) const;
+
+        /**
+         *   Thread-based global grouping
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[out] pd an FgfsStatDesc object
+         *   @param[in] item data item to group
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool grouping(bool global,
+                              FgfsParDesc &pd,
+                              std::string &item,
+                              bool elimAlias) const;
+
+        /**
+         *   Thread-based mapReduce
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[out] pd an FgfsStatDesc object
+         *   @param[in] itemList a item list containing unique item (vector type)
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool mapReduce(bool global,
+                               FgfsParDesc &pd,
+                               std::vector<std::string> &itemList,
+                               bool elimAlias) const;
+
+        /**
+         *   Thread-based getRankSize
+         *
+         *   @param[out] rank pointer to an int
+         *   @param[out] size pointer to an int
+         *   @param[out] glMaster is this rank the global master
+         *
+         *   @return a bool value
+         */
+        virtual bool getRankSize(int *rank, int *size, bool *glMaster) const;
+
+        /**
+         *   Thread-based reduceMap
+         *
+         *   @param[in] global bool indicating global vs. group
+         *   @param[in,out] pd an FgfsStatDesc object
+         *   @param[in] elimAlias flag that forces elimination of uri aliases
+         *
+         *   @return a bool value
+         */
+        virtual bool reduceMap(bool global,
+                               FgfsParDesc &pd,
+                               bool elimAlias) const;
+
+        /**
+         *   Thread-based allocNodeShared: all of the threads are on
+         *   one node
+         *
+         *   @param[in] len size of the segment; only rank 0's counts
+         *
+         *   @return a NodeSharedSegment object or NULL
+         */
+        virtual NodeSharedSegment *allocNodeShared(FgfsCount_t len) const;
+
+        ThreadCommWorld *getWorld() const;
+
+
+    private:
+
+        ThreadCommFabric(const ThreadCommFabric &c);
+
+        /**
+         *   the threads this fabric operates on
+         */
+        ThreadCommWorld *mWorld;
+
+        /**
+         *   the calling thread's rank
+         */
+        int mRank;
+    };
+  }
+}
+
+#endif // THREAD_COMM_FABRIC_H
@@ -6,6 +6,17 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Added TriageRequest for nonblocking triage.
+ *        Oct 17 2026: Added a longest-prefix mount point index.
+ *        Oct 17 2026: Added sparse bloom filter reductions.
+ *        Oct 17 2026: Added the adaptive bloom filter algorithm.
+ *        Oct 17 2026: Fused the remote flag into the estimator reductions.
+ *        Oct 17 2026: Added the hyperloglog algorithm.
+ *        Oct 17 2026: Implemented the hierarchical comm-split algorithms.
+ *        Oct 17 2026: Implemented the sampling cardinality estimator
+ *                     and added a cardinality upper bound.
+ *        Oct 17 2026: Added batched cardinality estimates over
+ *                     a list of paths.
  *        Jun 21 2011 DHA: Copied from the old FastGlobalFileStat.h
  *                         to organize the classes to support sync and async 
  *                         abstractions.
@@ -29,7 +40,10 @@ extern "C" {
 }
 
 #include <string>
+#include <vector>
+#include <map>
 #include "MountPointAttr.h"
+#include "MountPointIndex.h"
 #include "Comm/CommFabric.h"
 
 
@@ -281,6 +295,8 @@ namespace FastGlobalFileStatus {
         hier_commsplit,
         bloomfilter_hier_commsplit,
         sampling_hier_commsplit,
+        hyperloglog,
+        adaptive_bloomfilter,
         algo_unknown
     };
 
@@ -406,6 +422,21 @@ namespace FastGlobalFileStatus {
          */
         int setCardinalityEst(const int d);
 
+        /**
+         *   Return the upper confidence bound of the cardinality
+         *   estimate. Equals getCardinalityEst for exact or
+         *   bloom filter based estimates.
+         *   @return an integer upper bound
+         */
+        int getCardinalityUpperBound() const;
+
+        /**
+         *   Set the upper bound of the cardinality estimate
+         *   @param[in] d new upper bound of integer type
+         *   @return the old upper bound of integer type
+         */
+        int setCardinalityUpperBound(const int d);
+
 
     private:
 
@@ -438,6 +469,81 @@ namespace FastGlobalFileStatus {
          *   max likelihood of the set cardinality
          */
         int mCardinalityEst;
+
+        /**
+         *   upper confidence bound of the set cardinality
+         */
+        int mCardinalityUpperBound;
+    };
+
+
+    class GlobalFileStatusBase;
+
+
+    /**
+     *   Future-like handle of a triage started without blocking (see
+     *   SyncGlobalFileStatus::triageAsync). A request is a single
+     *   nonblocking collective posted when it is started, so requests
+     *   can be completed in any order. It progresses whenever test or
+     *   wait is called. The query object must not be
+     *   used until the request has completed and must outlive it. The
+     *   caller owns the request; deleting one that is still in flight
+     *   waits for it first.
+     */
+    class TriageRequest {
+    public:
+
+        ~TriageRequest();
+
+        /**
+         *   Advances the triage without blocking
+         *
+         *   @return true once the triage has completed
+         */
+        bool test();
+
+        /**
+         *   Blocks until the triage has completed
+         *
+         *   @return the same bool value that triage would have returned
+         */
+        bool wait();
+
+    private:
+
+        friend class GlobalFileStatusBase;
+
+        enum TriagePhase {
+            triage_flag,
+            triage_dense,
+            triage_done
+        };
+
+        TriageRequest(GlobalFileStatusBase *base, GlobalFileStatusAPI *gfsObj);
+
+        TriageRequest(const TriageRequest &r);
+
+        void post(TriagePhase phase);
+
+        bool progress(bool block);
+
+        void complete(int anyRemote, int est);
+
+        void finish(bool rc);
+
+        GlobalFileStatusBase *mBase;
+        GlobalFileStatusAPI *mGfsObj;
+        CommLayer::CommRequest *mReq;
+        TriagePhase mPhase;
+        bool mLocalErr;
+        bool mRc;
+        int mIsRemote;
+        int mAnyRemote;
+        int mM;
+        int mNumBytes;
+        std::string mUri;
+        std::vector<unsigned char> mSend;
+        std::vector<unsigned char> mRecv;
     };
 
 
@@ -463,6 +569,22 @@ namespace FastGlobalFileStatus {
          */
         static const int FGFS_UNIQUE_RANGE_MAX = 3;
 
+        /**
+         *   GlobalFileStatBase::FGFS_CARDINALITY_SAMPLE_SIZE (512)
+         *   Defines the number of processes sampled by the sampling
+         *   cardinality estimator. The message size of the estimator
+         *   is bounded by this value regardless of the process count.
+         */
+        static const int FGFS_CARDINALITY_SAMPLE_SIZE = 512;
+
+        /**
+         *   GlobalFileStatBase::FGFS_HLL_REGISTERS (4096)
+         *   Defines the number of one-byte registers of the HyperLogLog
+         *   sketch. The relative standard error of the estimate is
+         *   1.04/sqrt(FGFS_HLL_REGISTERS), about 1.6%, for any P.
+         */
+        static const int FGFS_HLL_REGISTERS = 4096;
+
         GlobalFileStatusBase();
 
         GlobalFileStatusBase(int threshold);
@@ -477,6 +599,14 @@ namespace FastGlobalFileStatus {
          */
         static const MountPointAttribute::MountPointInfo & getMpInfo();
 
+        /**
+         *   Return the longest-prefix index over the per-node mount
+         *   points. It is built from getMpInfo on first use.
+         *
+         *   @return a MountPointIndex object
+         */
+        static const MountPointIndex & getMountPointIndex();
+
         /**
          *   Return the CommFabric object, class static object holding
          *   communcation fabric layer
@@ -529,6 +659,14 @@ namespace FastGlobalFileStatus {
          */
         int setHiLoCutoff(const int th);
 
+        /**
+         *   Attaches classified global properties to the entries
+         *   of the mount point index
+         *   @param[in] props mount point to GlobalProperties map
+         */
+        static void attachMountPointProperties(
+                        const std::map<std::string, GlobalProperties> &props);
+
         /**
          *   Performs necessary communication to determine global
          *   properties including a number of different equivalent
@@ -550,6 +688,35 @@ namespace FastGlobalFileStatus {
         bool computeCardinalityEst(GlobalFileStatusAPI *gfsObj,
                                    CommAlgorithms algo=bloomfilter);
 
+        /**
+         *   Performs cardinality estimates for a list of paths at once.
+         *   All of the paths are resolved locally first and their
+         *   remote flags and bloom filters are packed into one
+         *   contiguous buffer so that the whole list is reduced with
+         *   a single allReduce. bases[i] and gfsObjs[i] must
+         *   refer to the same query object. The per-path results are
+         *   identical to those of computeCardinalityEst.
+         *   @param[in,out] bases GlobalFileStatusBase part of each object
+         *   @param[in,out] gfsObjs GlobalFileStatAPI part of each object
+         *   @param[in] algo an algorithm type of CommAlgorithms
+         *   @return success or failure of bool type
+         */
+        static bool computeCardinalityEst(
+                                   std::vector<GlobalFileStatusBase *> &bases,
+                                   std::vector<GlobalFileStatusAPI *> &gfsObjs,
+                                   CommAlgorithms algo=bloomfilter);
+
+        /**
+         *   Starts a cardinality estimate without blocking. The bloom
+         *   filter algorithm runs on nonblocking collectives; the other
+         *   algorithms complete before this returns.
+         *   @param[in,out] gfsObj a GlobalFileStatAPI object
+         *   @param[in] algo an algorithm type of CommAlgorithms
+         *   @return a TriageRequest object owned by the caller
+         */
+        TriageRequest *startCardinalityEst(GlobalFileStatusAPI *gfsObj,
+                                           CommAlgorithms algo=bloomfilter);
+
         /**
          *   Performs cardinality estimate based on the bloomfilter
          *   algorithm.
@@ -560,21 +727,174 @@ namespace FastGlobalFileStatus {
 
         /**
          *   Performs cardinality estimate based on the sampling
-         *   algorithm: No/
-         *   tImplemented
+         *   algorithm. A deterministic, rank-hash based subset of
+         *   processes contributes URI fingerprints and the number
+         *   of distinct URIs is estimated from that sample.
          *   @param[in,out] gfsObj a GlobalFileStatAPI object
          *   @return success or failure of bool type
          */
         bool samplingCardinalityEst(GlobalFileStatusAPI *gfsObj);
 
         /**
-         *   Performs cardinality estimate based on the generalized
-         *   comm-split: NotImplemented
+         *   Estimates the number of distinct uri strings across
+         *   all processes with a bloom filter reduction. The remote
+         *   flag rides in a header word of the same buffer. This is
+         *   a global collective.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; empty
+         *              if this process has none to contribute
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @param[in] key if not empty, keys the degree learned from
+         *              earlier estimates, which picks the encoding of
+         *              the reduction; the same on all processes
+         *   @return success or failure of bool type
+         */
+        static bool bloomfilterUriCardinality(CommLayer::FgfsParDesc &pd,
+                                              const std::string &uri,
+                                              int isRemote,
+                                              int *anyRemote,
+                                              int *est,
+                                              const std::string &key="");
+
+        /**
+         *   Adaptive version of bloomfilterUriCardinality. The first
+         *   round uses a small filter sized for the degree learned for
+         *   key (or a default), and the reduction is redone with
+         *   a larger filter only if the fill ratio of the result shows
+         *   that the filter was too small. The final estimate is
+         *   recorded as the learned degree of key so that later
+         *   queries with the same key need a single round.
+         *   This is a global collective and all processes must pass
+         *   the same key, e.g., the directory of the queried path,
+         *   never a per-process value such as the local mount point.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; may be empty
+         *   @param[in] key keys the learned degree
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @return success or failure of bool type
+         */
+        static bool adaptiveBloomfilterUriCardinality(
+                                   CommLayer::FgfsParDesc &pd,
+                                   const std::string &uri,
+                                   const std::string &key,
+                                   int isRemote,
+                                   int *anyRemote,
+                                   int *est);
+
+        /**
+         *   Performs cardinality estimate based on a HyperLogLog
+         *   sketch whose size is constant in the process count.
+         *   @param[in,out] gfsObj a GlobalFileStatAPI object
+         *   @return success or failure of bool type
+         */
+        bool hyperloglogCardinalityEst(GlobalFileStatusAPI *gfsObj);
+
+        /**
+         *   Estimates the number of distinct uri strings across all
+         *   processes with a HyperLogLog sketch of FGFS_HLL_REGISTERS
+         *   byte registers reduced with a byte-wise MAX. This is a
+         *   global collective.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; may be empty
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @param[out] upperBound 3-sigma upper bound of the estimate
+         *   @return success or failure of bool type
+         */
+        static bool hyperloglogUriCardinality(CommLayer::FgfsParDesc &pd,
+                                              const std::string &uri,
+                                              int isRemote,
+                                              int *anyRemote,
+                                              int *est,
+                                              int *upperBound);
+
+        /**
+         *   Estimates the number of distinct uri strings across
+         *   all processes from a sample of FGFS_CARDINALITY_SAMPLE_SIZE
+         *   processes using the Guaranteed-Error Estimator (GEE). 
+         *   When the sample covers all of the processes, the count 
+         *   is exact. This is a global collective.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; may be empty
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @param[out] upperBound upper bound of the estimate
+         *   @return success or failure of bool type
+         */
+        static bool samplingUriCardinality(CommLayer::FgfsParDesc &pd,
+                                           const std::string &uri,
+                                           int isRemote,
+                                           int *anyRemote,
+                                           int *est,
+                                           int *upperBound);
+
+        /**
+         *   Performs cardinality computation based on the hierarchical
+         *   comm-split: the fabric is split into node-local and node-leader
+         *   sub-fabrics and uris are deduplicated within each node so that
+         *   only node leaders take part in the grouping. As a by-product
+         *   the grouping information is also computed, and the
+         *   cardinality is exact.
          *   @param[in,out] gfsObj a GlobalFileStatAPI object
          *   @return success or failure of bool type
          */
         bool hier_commsplitCardinality(GlobalFileStatusAPI *gfsObj);
 
+        /**
+         *   Performs grouping based on the hierarchical comm-split. 
+         *   If the fabric can't be split or any node sees more than
+         *   one uri, this falls back to plain_parallelInfo.
+         *   @param[in,out] gfsObj a GlobalFileStatAPI object
+         *   @return success or failure of bool type
+         */
+        bool hier_parallelInfo(GlobalFileStatusAPI *gfsObj);
+
+        /**
+         *   Hierarchical version of bloomfilterUriCardinality: filters
+         *   are reduced within each node first, then across node leaders
+         *   and the result is broadcast within each node. Falls back to
+         *   bloomfilterUriCardinality if the fabric can't be split.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; may be empty
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @return success or failure of bool type
+         */
+        static bool bloomfilterUriCardinalityHier(CommLayer::FgfsParDesc &pd,
+                                                  const std::string &uri,
+                                                  int isRemote,
+                                                  int *anyRemote,
+                                                  int *est);
+
+        /**
+         *   Hierarchical version of samplingUriCardinality: the sample
+         *   slots are merged within each node first, then across node
+         *   leaders and the result is broadcast within each node. The
+         *   sample and the estimate are those of samplingUriCardinality.
+         *   Falls back to samplingUriCardinality if the fabric can't be
+         *   split.
+         *   @param[in] pd a parallel descriptor with rank and size set
+         *   @param[in] uri the uri of the calling process; may be empty
+         *   @param[in] isRemote 1 if the uri is on a remote file system
+         *   @param[out] anyRemote 1 if isRemote is set on any process
+         *   @param[out] est cardinality estimate
+         *   @param[out] upperBound upper bound of the estimate
+         *   @return success or failure of bool type
+         */
+        static bool samplingUriCardinalityHier(CommLayer::FgfsParDesc &pd,
+                                               const std::string &uri,
+                                               int isRemote,
+                                               int *anyRemote,
+                                               int *est,
+                                               int *upperBound);
+
         /**
          *   Performs cardinality check (accurate) based on the
          *   actual list reduction: NotImplemented
@@ -586,9 +906,88 @@ namespace FastGlobalFileStatus {
 
     private:
 
+        friend class TriageRequest;
+
         GlobalFileStatusBase(const GlobalFileStatusBase &s);
 
-        uint32_t getPopCount(uint32_t *filter, uint32_t s);
+        static bool resolveUri(GlobalFileStatusAPI *gfsObj,
+                               int *isRemote,
+                               std::string &uri);
+
+        static void setCardinalityResult(GlobalFileStatusAPI *gfsObj,
+                                         int anyRemote,
+                                         int cutoff,
+                                         int est,
+                                         int upperBound);
+
+        bool resolveRemoteAndUri(GlobalFileStatusAPI *gfsObj, int *anyRemote);
+
+        static FGFSInfoAnswer resolveRemote(const char *path,
+                                            MountPointAttribute::MyMntEnt &ent);
+
+        bool fusedCardinalityEst(GlobalFileStatusAPI *gfsObj);
+
+        static bool getNodeLocalFabrics(CommLayer::CommFabric **nodeFab,
+                                        CommLayer::CommFabric **leaderFab);
+
+        static bool fillSubParDesc(CommLayer::CommFabric *fab,
+                                   CommLayer::FgfsParDesc &subPd);
+
+        static bool bloomfilterCardinalityEstBatch(
+                                   std::vector<GlobalFileStatusBase *> &bases,
+                                   std::vector<GlobalFileStatusAPI *> &gfsObjs);
+
+        static int getBloomFilterSize(int P, int *numBytes);
+
+        static int alignBloomFilterSize(int m, int *numBytes);
+
+        static bool reduceBloomFilter(CommLayer::FgfsParDesc &pd,
+                                      const std::string &uri,
+                                      int isRemote,
+                                      int *anyRemote,
+                                      int m,
+                                      int numBytes,
+                                      unsigned char *filter,
+                                      int expectedDegree);
+
+        static bool reduceSparseBloomFilter(CommLayer::FgfsParDesc &pd,
+                                            const std::string &uri,
+                                            int isRemote,
+                                            int *anyRemote,
+                                            int m,
+                                            int numBytes,
+                                            unsigned char *filter,
+                                            bool *overflown);
+
+        static void fillSampleSlots(CommLayer::FgfsParDesc &pd,
+                                    const std::string &uri,
+                                    int isRemote,
+                                    int s,
+                                    long long *slots);
+
+        static void getSampleEstimate(long long *sample,
+                                      int s,
+                                      long long P,
+                                      int *est,
+                                      int *upperBound);
+
+        static int getLearnedDegree(const std::string &key, int dflt);
+
+        static void learnDegree(const std::string &key, int est);
+
+        static bool fillBloomFilter(const std::string &uri,
+                                    int m,
+                                    unsigned char *buf,
+                                    int numBytes);
+
+        static int getBloomCardinality(unsigned char *filter,
+                                       int numBytes,
+                                       int m);
+
+        static uint32_t getPopCount(const unsigned char *filter, int numBytes);
+
+        static double getHyperLogLogEstimate(const unsigned char *regs,
+                                             int m);
 
         /**
          *   error indicator
@@ -615,10 +1014,29 @@ namespace FastGlobalFileStatus {
          */
         static CommLayer::CommFabric *mCommFabric;
 
+        /**
+         *   node-local and node-leader sub-fabrics of mCommFabric,
+         *   created lazily by the hierarchical algorithms
+         */
+        static CommLayer::CommFabric *mNodeCommFabric;
+        static CommLayer::CommFabric *mLeaderCommFabric;
+        static bool mSplitTried;
+
+        /**
+         *   distribution degree learned per directory of queried
+         *   paths by the bloom filter algorithms
+         */
+        static std::map<std::string, int> mLearnedDegree;
+
         /**
          *   per-node mount point information
          */
         static MountPointAttribute::MountPointInfo mpInfo;
+
+        /**
+         *   longest-prefix index over mpInfo's mount points
+         */
+        static MountPointIndex mMountIndex;
     };
 }
 
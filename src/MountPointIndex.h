@@ -0,0 +1,147 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef MOUNT_POINT_INDEX_H
+#define MOUNT_POINT_INDEX_H 1
+
+extern "C" {
+#include <stdint.h>
+}
+
+#include <string>
+#include <vector>
+#include <map>
+#include "MountPointAttr.h"
+
+namespace FastGlobalFileStatus {
+
+    class GlobalProperties;
+
+
+    /**
+     *   Per mount point record of MountPointIndex: everything a query
+     *   needs from the mount table, resolved once when the index
+     *   is built.
+     */
+    class MountPointIndexEntry {
+    public:
+        MountPointIndexEntry();
+        ~MountPointIndexEntry();
+
+        const std::string & getMountPoint() const;
+        const MountPointAttribute::MyMntEnt & getMyEntry() const;
+        FGFSInfoAnswer isRemote() const;
+        const std::string & getUriPrefix() const;
+
+        /**
+         *   Returns the GlobalProperties of the mount point; NULL
+         *   unless the mount points were classified.
+         */
+        const GlobalProperties * getGlobalProperties() const;
+
+    private:
+        friend class MountPointIndex;
+
+        std::string mMountPoint;
+        MountPointAttribute::MyMntEnt mEntry;
+        FGFSInfoAnswer mRemote;
+        std::string mUriPrefix;
+        const GlobalProperties *mProps;
+    };
+
+
+    /**
+     *   Immutable longest-prefix index over the mount table. Mount
+     *   points are stored in a path-component trie flattened into
+     *   arrays: the children of a node are contiguous and sorted, and
+     *   all labels live in a single character buffer. A lookup walks
+     *   the components of the path with a binary search at each level,
+     *   so it is O(path length) and does no heap allocation.
+     *   Paths must be absolute with no links, as everywhere else in
+     *   this library.
+     */
+    class MountPointIndex {
+    public:
+        MountPointIndex();
+        ~MountPointIndex();
+
+        /**
+         *   Builds the index from the mount table of mpInfo. The
+         *   remote answer and the uri prefix of each mount point
+         *   are resolved here, once.
+         *
+         *   @param[in] mpInfo parsed mount point information
+         *   @return a bool value
+         */
+        bool build(const MountPointAttribute::MountPointInfo &mpInfo);
+
+        /**
+         *   Attaches GlobalProperties to the entries whose mount
+         *   point is a key of props. props must outlive the index.
+         *
+         *   @param[in] props mount point to GlobalProperties map
+         */
+        void attachGlobalProperties(
+                 const std::map<std::string, GlobalProperties> &props);
+
+        /**
+         *   Returns the entry of the longest mount point that is
+         *   a prefix of path at a component boundary
+         *
+         *   @param[in] path an absolute path
+         *   @return an entry or NULL if nothing matches
+         */
+        const MountPointIndexEntry * lookup(const char *path) const;
+
+        /**
+         *   Batch version of lookup
+         *
+         *   @param[in] paths absolute paths
+         *   @param[out] entries entries[i] is lookup(paths[i])
+         *   @return the number of paths that were resolved
+         */
+        size_t lookup(const std::vector<std::string> &paths,
+                      std::vector<const MountPointIndexEntry *> &entries) const;
+
+        bool isBuilt() const;
+
+        size_t size() const;
+
+    private:
+
+        /**
+         *   A trie node: label is mLabels[labelOff, labelOff+labelLen),
+         *   children are mNodes[childBegin, childBegin+childCount),
+         *   entry is an index into mEntries or -1.
+         */
+        struct Node {
+            uint32_t labelOff;
+            uint32_t labelLen;
+            uint32_t childBegin;
+            uint32_t childCount;
+            int32_t entry;
+        };
+
+        const Node * findChild(const Node &n,
+                               const char *comp,
+                               uint32_t len) const;
+
+        MountPointIndex(const MountPointIndex &o);
+
+        std::vector<Node> mNodes;
+        std::vector<char> mLabels;
+        std::vector<MountPointIndexEntry> mEntries;
+        bool mBuilt;
+    };
+
+}
+
+#endif // MOUNT_POINT_INDEX_H
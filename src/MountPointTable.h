@@ -0,0 +1,147 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef MOUNT_POINT_TABLE_H
+#define MOUNT_POINT_TABLE_H 1
+
+extern "C" {
+#include <stdint.h>
+#include <stddef.h>
+}
+
+#include <string>
+#include <map>
+#include "Comm/GroupTable.h"
+
+namespace FastGlobalFileStatus {
+
+    class GlobalProperties;
+
+
+    /**
+     *   FGFS_MOUNT_POINT_TABLE_VERSION
+     *   Version of the packed mount point table
+     */
+    const uint32_t FGFS_MOUNT_POINT_TABLE_VERSION = 1;
+
+
+    /**
+     *   Per mount point record of a packed mount point table: the
+     *   node-invariant part of GlobalProperties. Offsets are from
+     *   the start of the table.
+     */
+    struct FgfsMountPointRecord {
+        uint32_t pathOff;
+        uint32_t pathLen;
+        uint32_t fsNameOff;
+        uint32_t fsNameLen;
+        uint64_t groupsOff;     // packed FgfsGroupTable, 8-byte aligned
+        uint64_t groupsLen;
+        int32_t unique;
+        int32_t poorlyDist;
+        int32_t wellDist;
+        int32_t fullyDist;
+        int32_t consistent;
+        int32_t fsType;
+        int32_t fsSpeed;
+        int32_t fsScalability;
+        int32_t distributionDegree;
+        int32_t numOfGroups;
+    };
+
+
+    /**
+     *   Packs classified mount points into a flat table with no
+     *   pointers, so that one process can build it into memory that
+     *   others map at a different address.
+     *
+     *   Packed layout, native byte order:
+     *
+     *     uint32_t version, records, reserved, reserved
+     *     FgfsMountPointRecord[records], sorted by path
+     *     paths and file system names, NUL-terminated
+     *     per record, its grouping map as a packed FgfsGroupTable
+     *       with item strings, padded to 8 bytes
+     */
+    class FgfsMountPointTable {
+    public:
+
+        /**
+         *   Packs props
+         *
+         *   @param[in] props mount point to GlobalProperties map
+         *   @param[out] len size of the table
+         *
+         *   @return malloc'd table the caller frees; NULL on error
+         */
+        static char * pack(const std::map<std::string, GlobalProperties> &props,
+                           size_t *len);
+    };
+
+
+    /**
+     *   Read-only view of a packed mount point table. Queries run in
+     *   place and do no heap allocation.
+     */
+    class FgfsMountPointTableView {
+    public:
+        FgfsMountPointTableView();
+
+        /**
+         *   Attaches to a packed table after checking its bounds
+         *
+         *   @param[in] buf packed table; 8-byte aligned as malloc
+         *                  and shared memory are
+         *   @param[in] s size of the table
+         *
+         *   @return false if the table is malformed
+         */
+        bool attach(const char *buf, size_t s);
+
+        void detach();
+
+        size_t size() const;
+
+        const FgfsMountPointRecord & record(size_t i) const;
+
+        /**
+         *   Binary search for a mount point
+         *
+         *   @param[in] mountPoint a logical mount point path
+         *   @return the record or NULL
+         */
+        const FgfsMountPointRecord * find(const char *mountPoint) const;
+
+        const char * getPath(const FgfsMountPointRecord &r) const;
+
+        const char * getFsName(const FgfsMountPointRecord &r) const;
+
+        /**
+         *   Views the grouping map of a record
+         *
+         *   @param[in] r a record of this table
+         *   @param[out] v view of the record's packed group table
+         *
+         *   @return a bool value
+         */
+        bool getGroups(const FgfsMountPointRecord &r,
+                       CommLayer::FgfsGroupTableView &v) const;
+
+    private:
+        const char *mBuf;
+        size_t mLen;
+        const FgfsMountPointRecord *mRecords;
+        size_t mSize;
+    };
+
+}
+
+#endif // MOUNT_POINT_TABLE_H
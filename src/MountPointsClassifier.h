@@ -6,6 +6,8 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: The classified table is shared within a node.
+ *        Oct 17 2026: setParDesc takes a const reference.
  *        Aug 26 2011 DHA: File created
  *
  */
@@ -14,6 +16,7 @@
 #define MOUNT_POINTS_CLASSIFIER_H 1
 
 #include "SyncFastGlobalFileStat.h"
+#include "MountPointTable.h"
 
 namespace FastGlobalFileStatus {
 
@@ -55,7 +58,7 @@ namespace FastGlobalFileStatus {
         void setFsSpeed(int speed);
         void setFsScalability(int scal);
         void setDistributionDegree(int dist);
-        void setParDesc(const CommLayer::FgfsParDesc pd);
+        void setParDesc(const CommLayer::FgfsParDesc &pd);
 
     private:
         FGFSInfoAnswer mUnique;
@@ -75,6 +78,13 @@ namespace FastGlobalFileStatus {
     /**
      *   Data type that classifies all of the globally available 
      *   mount points and store in its datebase mAnnoteMountPoints
+     *
+     *   When the fabric supports node-shared memory, one process
+     *   per node then packs the classified mount points into a
+     *   FgfsMountPointTable that all processes of the node map, and
+     *   each process drops the grouping maps of its descriptors in
+     *   mAnnoteMountPoints: they are read from getSharedTable
+     *   instead. The rest of GlobalProperties stays per process.
      */
     class MountPointsClassifier : public GlobalFileStatusBase {
     public:
@@ -87,7 +97,27 @@ namespace FastGlobalFileStatus {
         static const std::map<std::string, GlobalProperties> & 
                      getGlobalMountpointsMap();
 
+        /**
+         *   Returns the node-shared table of the classified mount
+         *   points; empty unless the fabric could share memory
+         *
+         *   @return a FgfsMountPointTableView object
+         */
+        static const FgfsMountPointTableView & getSharedTable();
+
         static std::map<std::string, GlobalProperties> mAnnoteMountPoints;
+
+    private:
+
+        /**
+         *   Builds the node-shared table from mAnnoteMountPoints.
+         *   This is a global collective.
+         */
+        static bool shareTable();
+
+        static CommLayer::NodeSharedSegment *mSharedSegment;
+
+        static FgfsMountPointTableView mSharedTable;
     };
 }
 
@@ -0,0 +1,163 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef SIM_MOUNT_LAYOUT_H
+#define SIM_MOUNT_LAYOUT_H 1
+
+#include <string>
+#include <vector>
+#include "MountPointAttr.h"
+#include "Comm/SimCommFabric.h"
+
+namespace FastGlobalFileStatus {
+
+    /**
+     *   Which ranks see the same file server on a mount point
+     */
+    enum SimMountScope {
+        sms_global = 0,  // all of them
+        sms_perUnit,     // the ranks of a scalable unit
+        sms_perNode,     // the ranks of a node, e.g., a local file system
+        sms_aliased      // all of them, under one of two server names
+    };
+
+
+    /**
+     *   Synthetic mount tables of P ranks for SimCommFabric. The
+     *   ranks are packed onto nodes of procsPerNode ranks and the
+     *   nodes onto scalable units of nodesPerUnit nodes; a mount
+     *   point is served according to its scope. Every rank gets its
+     *   entry and uri from a formula, so a layout of a million ranks
+     *   costs no more than one of a few.
+     */
+    class SimMountLayout {
+    public:
+
+        /**
+         *   SimMountLayout Ctor
+         *
+         *   @param[in] size number of ranks
+         *   @param[in] procsPerNode ranks per node
+         *   @param[in] nodesPerUnit nodes per scalable unit
+         */
+        SimMountLayout(CommLayer::FgfsCount_t size,
+                       int procsPerNode,
+                       int nodesPerUnit);
+
+        ~SimMountLayout();
+
+        /**
+         *   Adds a mount point
+         *
+         *   @param[in] dir the mount point
+         *   @param[in] fsType file system type, e.g., nfs
+         *   @param[in] scope who shares a server
+         *   @param[in] remote whether the file system is remote
+         *   @param[in] server server host; a %d in it becomes the
+         *                     index of the unit or the node for
+         *                     sms_perUnit and sms_perNode
+         *   @param[in] exportPath the exported directory
+         *   @param[in] aliasServer for sms_aliased, the other name
+         *                          of server, used by odd nodes
+         */
+        void addMount(const std::string &dir,
+                      const std::string &fsType,
+                      SimMountScope scope,
+                      bool remote,
+                      const std::string &server,
+                      const std::string &exportPath,
+                      const std::string &aliasServer="");
+
+        CommLayer::FgfsCount_t getSize() const;
+
+        /**
+         *   Fills the mount entry of path as rank sees it; the mount
+         *   point is the longest one that prefixes path
+         *
+         *   @param[in] rank the rank
+         *   @param[in] path an absolute path
+         *   @param[out] ent the entry
+         *
+         *   @return false if no mount point covers path
+         */
+        bool getEntry(CommLayer::FgfsId_t rank,
+                      const std::string &path,
+                      MountPointAttribute::MyMntEnt &ent) const;
+
+        /**
+         *   Returns the uri of path as rank sees it,
+         *   fsType://server/exportPath/rest
+         *
+         *   @param[in] rank the rank
+         *   @param[in] path an absolute path
+         *   @param[out] uri the uri
+         *   @param[out] isRemote 1 if the file system is remote
+         *
+         *   @return false if no mount point covers path
+         */
+        bool getUri(CommLayer::FgfsId_t rank,
+                    const std::string &path,
+                    std::string &uri,
+                    int *isRemote) const;
+
+        /**
+         *   Returns the fewest classes of ranks that see the same uri
+         *   for path; the first rank of a class stands for the rest
+         *
+         *   @param[in] path an absolute path
+         *   @param[out] classes runs of ranks covering 0 to size-1
+         *
+         *   @return false if no mount point covers path
+         */
+        bool getRankClasses(const std::string &path,
+                            std::vector<CommLayer::SimRankClass> &classes) const;
+
+        /**
+         *   Returns the exact number of different uris of path, the
+         *   answer the cardinality estimators approximate
+         *
+         *   @param[in] path an absolute path
+         *
+         *   @return the number of uris; 0 if no mount point covers path
+         */
+        CommLayer::FgfsCount_t getCardinality(const std::string &path) const;
+
+
+    private:
+
+        struct SimMount {
+            std::string dir;
+            std::string fsType;
+            SimMountScope scope;
+            bool remote;
+            std::string server;
+            std::string exportPath;
+            std::string aliasServer;
+        };
+
+        int findMount(const std::string &path) const;
+
+        CommLayer::FgfsCount_t getChunk(const SimMount &m) const;
+
+        std::string getServer(const SimMount &m,
+                              CommLayer::FgfsId_t rank) const;
+
+        CommLayer::FgfsCount_t mSize;
+
+        int mProcsPerNode;
+
+        int mNodesPerUnit;
+
+        std::vector<SimMount> mMounts;
+    };
+}
+
+#endif // SIM_MOUNT_LAYOUT_H
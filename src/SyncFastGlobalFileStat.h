@@ -6,6 +6,9 @@
  *
  * Update Log:
  *
+ *        Oct 17 2026: Added localSigniture and nodeSharedSigniture.
+ *        Oct 17 2026: Added triageAsync.
+ *        Oct 17 2026: Added triageMany for batched triage.
  *        Jun 21 2011 DHA: File created
  *
  */
@@ -100,6 +103,38 @@ namespace FastGlobalFileStatus {
          */
         bool triage(CommAlgorithms algo=bloomfilter);
 
+        /**
+         *   Nonblocking version of triage. This is a global collective
+         *   in the same way as triage, but it only starts the
+         *   reductions and returns; the caller can overlap them with
+         *   other work and complete them through the returned request.
+         *   The other methods of this object must not be called until
+         *   the request has completed. Only the bloom filter algorithm
+         *   is truly nonblocking; the other algorithms complete before
+         *   this returns.
+         *
+         *   @param[in] algo CommAlorithms (default: bloom filter based)
+         *   @return a TriageRequest object owned by the caller;
+         *           NULL on error
+         */
+        TriageRequest *triageAsync(CommAlgorithms algo=bloomfilter);
+
+        /**
+         *   Batched version of triage. This is a global collective: all
+         *   distributed components must call it synchronously with the 
+         *   same number of objects in the same order. The cardinality
+         *   estimates of all of the objects are computed with a constant
+         *   number of collective operations instead of one set of
+         *   collectives per object. Each object ends up in the same
+         *   state as if its triage method had been called.
+         *
+         *   @param[in,out] objs SyncGlobalFileStatus objects to triage
+         *   @param[in] algo CommAlorithms (default: bloom filter based)
+         *   @return a bool value
+         */
+        static bool triageMany(std::vector<SyncGlobalFileStatus *> &objs,
+                               CommAlgorithms algo=bloomfilter);
+
         /**
          *   Is the path served in the fully distributed fashion?
          *   The path is served through node local storage. Yes implies
@@ -145,7 +180,8 @@ namespace FastGlobalFileStatus {
          *
          *   @param[in] serial the method performs file signiture
          *                      computation serially if true. Only set
-         *                      this flag for debugging
+         *                      this flag for debugging; it must be the
+         *                      same on all processes
          *   @return an FGFSInfoAnswer object
          */
         FGFSInfoAnswer isConsistent(bool serial=false);
@@ -153,7 +189,7 @@ namespace FastGlobalFileStatus {
         /**
          *   Computes a signiture of the file using the registered
          *   FileSignitureGen object. This function uses a scalable approach
-         *   to generate the signiture buffer.
+         *   to generate the signiture buffer. This is a global collective.
          *
          *   @param[out] buf a pointer to the allocated struct stat. This method
          *                    fills this info using a scalable algorithm.
@@ -166,8 +202,14 @@ namespace FastGlobalFileStatus {
         /**
          *   Computes a signiture of the file using the registered
          *   FileSignitureGen object. This function uses a non-scalable approach
-         *   to generate the signiture buffer. This method should only be used for
-         *   debugging and testing.
+         *   to generate the signiture buffer: one process per node computes
+         *   it, whatever the distribution of the file. This method should only
+         *   be used for debugging and testing.
+         *
+         *   Despite its name, this is a global collective, like
+         *   signiture: the node's processes share the result through
+         *   CommFabric::allocNodeShared, whose first use splits the
+         *   whole fabric. Every process must call it, or none.
          *
          *   @param[out] buf a pointer to the allocated struct stat. This method
          *                    fills this info using a scalable algorithm.
@@ -182,6 +224,26 @@ namespace FastGlobalFileStatus {
 
     private:
 
+        bool setParallelInfo(int rank, int size, bool isMaster);
+
+        /**
+         *   Stats, opens and signs a path
+         *
+         *   @return the malloc'd signiture; NULL on error
+         */
+        static unsigned char * localSigniture(const char *path,
+                                              struct stat *sb,
+                                              int *sigSize);
+
+        /**
+         *   localSigniture done by one process per node and shared
+         *   with the others through CommFabric::allocNodeShared. This
+         *   is a global collective.
+         *
+         *   @return the malloc'd signiture; NULL on error
+         */
+        unsigned char * nodeSharedSigniture(struct stat *sb, int *sigSize);
+
         /**
          *   FileSignitureGen
          */
@@ -108,3 +108,25 @@ unsigned int sdbm_hash(const char *key)
 	return h;
 }
 
+/*
+ * 64-bit FNV-1a followed by the MurmurHash3 finalizer so that
+ * every bit of the result depends on every byte of the key.
+ */
+uint64_t fnv_hash64(const char *key)
+{
+	uint64_t h=14695981039346656037ULL;
+
+	while(*key) {
+		h^=(unsigned char)*key++;
+		h*=1099511628211ULL;
+	}
+
+	h^=h>>33;
+	h*=0xff51afd7ed558ccdULL;
+	h^=h>>33;
+	h*=0xc4ceb93fe53b80a3ULL;
+	h^=h>>33;
+
+	return h;
+}
+
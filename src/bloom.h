@@ -28,6 +28,7 @@ Retrieved from: http://en.literateprograms.org/Bloom_filter_(C)?oldid=16893
 #define __BLOOM_H__
 
 #include <stdlib.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +49,7 @@ extern int bloom_check(BLOOM *bloom, const char *s);
 
 extern unsigned int sax_hash(const char *key);
 extern unsigned int sdbm_hash(const char *key);
+extern uint64_t fnv_hash64(const char *key);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,265 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#include <string.h>
+#include "bloomvec.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__clang__) \
+        || (defined(__GNUC__) \
+            && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define BLOOMVEC_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*bloomvec_or_t)(unsigned char *, const unsigned char *, size_t);
+typedef uint64_t (*bloomvec_popcount_t)(const unsigned char *, size_t);
+
+static bloomvec_or_t or_kernel = NULL;
+static bloomvec_popcount_t popcount_kernel = NULL;
+static const char *kernel_name = "scalar";
+static int force_scalar = 0;
+
+
+/*
+ * Double hashing (Kirsch and Mitzenmacher): g_i(x) = h1(x) + i*h2(x)
+ * gives k indices that are as good as k independent hashes for a
+ * bloom filter. h2 is made odd so that it never degenerates to 0.
+ */
+void bloomvec_add(unsigned char *filter, size_t nbits,
+                  uint64_t h, unsigned int k)
+{
+    uint64_t h1 = h;
+    uint64_t h2 = ((h >> 32) | (h << 32)) | 1ULL;
+    unsigned int i;
+
+    for (i=0; i < k; ++i) {
+        uint64_t bit = (h1 + (uint64_t) i * h2) % (uint64_t) nbits;
+        filter[bit >> 3] |= (unsigned char) (1U << (bit & 7));
+    }
+}
+
+
+int bloomvec_check(const unsigned char *filter, size_t nbits,
+                   uint64_t h, unsigned int k)
+{
+    uint64_t h1 = h;
+    uint64_t h2 = ((h >> 32) | (h << 32)) | 1ULL;
+    unsigned int i;
+
+    for (i=0; i < k; ++i) {
+        uint64_t bit = (h1 + (uint64_t) i * h2) % (uint64_t) nbits;
+        if (!(filter[bit >> 3] & (1U << (bit & 7)))) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+/*
+ * Scalar kernels: 64-bit words through memcpy so that the buffers
+ * need no particular alignment, then the trailing bytes.
+ */
+static void or_scalar(unsigned char *dst, const unsigned char *src,
+                      size_t nbytes)
+{
+    size_t i = 0;
+    uint64_t a, b;
+
+    for (; i + 8 <= nbytes; i += 8) {
+        memcpy(&a, dst + i, 8);
+        memcpy(&b, src + i, 8);
+        a |= b;
+        memcpy(dst + i, &a, 8);
+    }
+    for (; i < nbytes; ++i) {
+        dst[i] |= src[i];
+    }
+}
+
+
+static uint64_t popcount64_swar(uint64_t x)
+{
+    x -= (x >> 1) & 0x5555555555555555ULL;
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (x * 0x0101010101010101ULL) >> 56;
+}
+
+
+static uint64_t popcount_scalar(const unsigned char *filter, size_t nbytes)
+{
+    size_t i = 0;
+    uint64_t x, cnt = 0;
+
+    for (; i + 8 <= nbytes; i += 8) {
+        memcpy(&x, filter + i, 8);
+        cnt += popcount64_swar(x);
+    }
+    for (; i < nbytes; ++i) {
+        cnt += popcount64_swar((uint64_t) filter[i]);
+    }
+
+    return cnt;
+}
+
+
+#ifdef BLOOMVEC_X86
+
+__attribute__((target("sse2")))
+static void or_sse2(unsigned char *dst, const unsigned char *src,
+                    size_t nbytes)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= nbytes; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (dst + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_or_si128(a, b));
+    }
+    or_scalar(dst + i, src + i, nbytes - i);
+}
+
+
+__attribute__((target("popcnt")))
+static uint64_t popcount_popcnt(const unsigned char *filter, size_t nbytes)
+{
+    size_t i = 0;
+    uint64_t x, cnt = 0;
+
+    for (; i + 8 <= nbytes; i += 8) {
+        memcpy(&x, filter + i, 8);
+        cnt += (uint64_t) __builtin_popcountll(x);
+    }
+    for (; i < nbytes; ++i) {
+        cnt += (uint64_t) __builtin_popcount((unsigned int) filter[i]);
+    }
+
+    return cnt;
+}
+
+
+__attribute__((target("avx2")))
+static void or_avx2(unsigned char *dst, const unsigned char *src,
+                    size_t nbytes)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= nbytes; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (dst + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (src + i));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_or_si256(a, b));
+    }
+    or_scalar(dst + i, src + i, nbytes - i);
+}
+
+
+/*
+ * Nibble lookup with vpshufb (Mula et al.): each byte is split into
+ * two nibbles whose bit counts are looked up 32 at a time, and
+ * vpsadbw folds the byte counts into four 64-bit lanes.
+ */
+__attribute__((target("avx2,popcnt")))
+static uint64_t popcount_avx2(const unsigned char *filter, size_t nbytes)
+{
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0f);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    uint64_t lanes[4];
+
+    for (; i + 32 <= nbytes; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (filter + i));
+        __m256i lo = _mm256_and_si256(v, lowMask);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask);
+        __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                      _mm256_shuffle_epi8(lookup, hi));
+        acc = _mm256_add_epi64(acc,
+                  _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+    }
+
+    _mm256_storeu_si256((__m256i *) lanes, acc);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3]
+           + popcount_popcnt(filter + i, nbytes - i);
+}
+
+#endif
+
+
+static void select_kernels(void)
+{
+    bloomvec_or_t orK = or_scalar;
+    bloomvec_popcount_t popK = popcount_scalar;
+    const char *name = "scalar";
+
+#ifdef BLOOMVEC_X86
+    if (!force_scalar) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")
+            && __builtin_cpu_supports("popcnt")) {
+            orK = or_avx2;
+            popK = popcount_avx2;
+            name = "avx2";
+        }
+        else if (__builtin_cpu_supports("popcnt")) {
+            orK = or_sse2;
+            popK = popcount_popcnt;
+            name = "popcnt";
+        }
+    }
+#endif
+
+    /*
+     * Racing first calls store the same values
+     */
+    kernel_name = name;
+    popcount_kernel = popK;
+    or_kernel = orK;
+}
+
+
+void bloomvec_or(unsigned char *dst, const unsigned char *src, size_t nbytes)
+{
+    if (!or_kernel) {
+        select_kernels();
+    }
+    or_kernel(dst, src, nbytes);
+}
+
+
+uint64_t bloomvec_popcount(const unsigned char *filter, size_t nbytes)
+{
+    if (!popcount_kernel) {
+        select_kernels();
+    }
+    return popcount_kernel(filter, nbytes);
+}
+
+
+const char *bloomvec_kernel_name(void)
+{
+    if (!or_kernel) {
+        select_kernels();
+    }
+    return kernel_name;
+}
+
+
+void bloomvec_use_scalar(int on)
+{
+    force_scalar = on;
+    select_kernels();
+}
@@ -0,0 +1,54 @@
+/*
+ * --------------------------------------------------------------------------------
+ * Copyright (c) 2011, Lawrence Livermore National Security, LLC. Produced at
+ * the Lawrence Livermore National Laboratory. Written by Dong H. Ahn <ahn1@llnl.gov>.
+ * All rights reserved.
+ *
+ * Update Log:
+ *        Oct 17 2026: File created.
+ *
+ */
+
+#ifndef __BLOOMVEC_H__
+#define __BLOOMVEC_H__
+
+/*
+ * Word-oriented bloom filter kernels. A filter is a byte array whose
+ * length is a multiple of 8 (one 64-bit word) and bit i lives in byte
+ * i/8. Items are entered with a single 64-bit hash that is expanded
+ * into k indices by double hashing. The OR and popcount kernels are
+ * picked at run time: AVX2, then POPCNT/SSE2 and finally a portable
+ * scalar version.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern void bloomvec_add(unsigned char *filter, size_t nbits,
+                         uint64_t h, unsigned int k);
+extern int bloomvec_check(const unsigned char *filter, size_t nbits,
+                          uint64_t h, unsigned int k);
+extern void bloomvec_or(unsigned char *dst, const unsigned char *src,
+                        size_t nbytes);
+extern uint64_t bloomvec_popcount(const unsigned char *filter,
+                                  size_t nbytes);
+
+/*
+ * Name of the kernel set in use: "avx2", "popcnt" or "scalar"
+ */
+extern const char *bloomvec_kernel_name(void);
+
+/*
+ * Forces the scalar kernels when on is non-zero; mostly for testing
+ */
+extern void bloomvec_use_scalar(int on);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BLOOMVEC_H__ */